@@ -3,7 +3,9 @@
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/string_util.hpp"
 
+#include <algorithm>
 #include <utility>
 
 namespace duckdb {
@@ -12,10 +14,20 @@ JSONBufferHandle::JSONBufferHandle(idx_t buffer_index_p, idx_t readers_p, Alloca
     : buffer_index(buffer_index_p), readers(readers_p), buffer(std::move(buffer_p)), buffer_size(buffer_size_p) {
 }
 
-JSONFileHandle::JSONFileHandle(unique_ptr<FileHandle> file_handle_p, Allocator &allocator_p)
-    : file_handle(std::move(file_handle_p)), allocator(allocator_p), can_seek(file_handle->CanSeek()),
-      plain_file_source(file_handle->OnDiskFile() && can_seek), file_size(file_handle->GetFileSize()), read_position(0),
-      requested_reads(0), actual_reads(0), cached_size(0) {
+static idx_t GetUncompressedSize(const vector<GZipBlock> &gzip_blocks) {
+	if (gzip_blocks.empty()) {
+		return 0;
+	}
+	auto &last_block = gzip_blocks.back();
+	return last_block.uncompressed_offset + last_block.uncompressed_size;
+}
+
+JSONFileHandle::JSONFileHandle(unique_ptr<FileHandle> file_handle_p, Allocator &allocator_p,
+                               vector<GZipBlock> gzip_blocks_p)
+    : file_handle(std::move(file_handle_p)), allocator(allocator_p), gzip_blocks(std::move(gzip_blocks_p)),
+      can_seek(file_handle->CanSeek()), plain_file_source(file_handle->OnDiskFile() && can_seek),
+      file_size(gzip_blocks.empty() ? file_handle->GetFileSize() : GetUncompressedSize(gzip_blocks)),
+      read_position(0), requested_reads(0), actual_reads(0), cached_size(0) {
 }
 
 bool JSONFileHandle::IsOpen() const {
@@ -71,7 +83,11 @@ idx_t JSONFileHandle::GetPositionAndSize(idx_t &position, idx_t requested_size)
 void JSONFileHandle::ReadAtPosition(char *pointer, idx_t size, idx_t position, bool sample_run) {
 	D_ASSERT(size != 0);
 	if (plain_file_source) {
-		file_handle->Read(pointer, size, position);
+		if (gzip_blocks.empty()) {
+			file_handle->Read(pointer, size, position);
+		} else {
+			ReadFromGZipBlocks(pointer, size, position);
+		}
 		actual_reads++;
 
 		return;
@@ -167,6 +183,48 @@ idx_t JSONFileHandle::ReadFromCache(char *&pointer, idx_t &size, idx_t &position
 	return read_size;
 }
 
+void JSONFileHandle::ReadFromGZipBlocks(char *pointer, idx_t size, idx_t position) {
+	D_ASSERT(position + size <= file_size);
+	// find the range of members that hold the requested bytes
+	auto compare = [](idx_t pos, const GZipBlock &block) {
+		return pos < block.uncompressed_offset;
+	};
+	idx_t begin_idx =
+	    std::upper_bound(gzip_blocks.begin(), gzip_blocks.end(), position, compare) - gzip_blocks.begin() - 1;
+	idx_t end_idx = std::upper_bound(gzip_blocks.begin(), gzip_blocks.end(), position + size - 1, compare) -
+	                gzip_blocks.begin();
+
+	// read the compressed members with a single read, then decompress them one by one
+	auto compressed_start = gzip_blocks[begin_idx].compressed_offset;
+	auto &last_block = gzip_blocks[end_idx - 1];
+	auto compressed_size = last_block.compressed_offset + last_block.compressed_size - compressed_start;
+	auto compressed = allocator.Allocate(compressed_size);
+	file_handle->Read(compressed.get(), compressed_size, compressed_start);
+
+	AllocatedData partial_block;
+	for (idx_t block_idx = begin_idx; block_idx < end_idx; block_idx++) {
+		auto &block = gzip_blocks[block_idx];
+		auto block_data = compressed.get() + (block.compressed_offset - compressed_start);
+		auto offset_in_block = position - block.uncompressed_offset;
+		auto copy_size = MinValue<idx_t>(size, block.uncompressed_size - offset_in_block);
+		if (copy_size == block.uncompressed_size) {
+			// the whole member is requested: decompress it in place
+			GZipFileSystem::UncompressBlock(block, block_data, data_ptr_cast(pointer));
+		} else {
+			// only part of the member is requested (first or last member)
+			if (partial_block.GetSize() < block.uncompressed_size) {
+				partial_block = allocator.Allocate(block.uncompressed_size);
+			}
+			GZipFileSystem::UncompressBlock(block, block_data, partial_block.get());
+			memcpy(pointer, partial_block.get() + offset_in_block, copy_size);
+		}
+		pointer += copy_size;
+		position += copy_size;
+		size -= copy_size;
+	}
+	D_ASSERT(size == 0);
+}
+
 BufferedJSONReader::BufferedJSONReader(ClientContext &context, BufferedJSONReaderOptions options_p, string file_name_p)
     : context(context), options(std::move(options_p)), file_name(std::move(file_name_p)), buffer_index(0),
       thrown(false) {
@@ -176,9 +234,26 @@ void BufferedJSONReader::OpenJSONFile() {
 	lock_guard<mutex> guard(lock);
 	if (!IsOpen()) {
 		auto &file_system = FileSystem::GetFileSystem(context);
-		auto regular_file_handle = file_system.OpenFile(file_name.c_str(), FileFlags::FILE_FLAGS_READ,
-		                                                FileLockType::NO_LOCK, options.compression);
-		file_handle = make_uniq<JSONFileHandle>(std::move(regular_file_handle), BufferAllocator::Get(context));
+		unique_ptr<FileHandle> regular_file_handle;
+		vector<GZipBlock> gzip_blocks;
+		if (options.compression == FileCompressionType::GZIP ||
+		    (options.compression == FileCompressionType::AUTO_DETECT &&
+		     StringUtil::EndsWith(StringUtil::Lower(file_name), ".gz"))) {
+			// BGZF files can be decompressed member by member, which lets multiple threads read the same file
+			auto raw_file_handle = file_system.OpenFile(file_name.c_str(), FileFlags::FILE_FLAGS_READ,
+			                                            FileLockType::NO_LOCK, FileCompressionType::UNCOMPRESSED);
+			if (raw_file_handle->OnDiskFile() && raw_file_handle->CanSeek() &&
+			    GZipFileSystem::TryIndexBlocks(*raw_file_handle, gzip_blocks) && !gzip_blocks.empty()) {
+				regular_file_handle = std::move(raw_file_handle);
+			}
+		}
+		if (!regular_file_handle) {
+			gzip_blocks.clear();
+			regular_file_handle = file_system.OpenFile(file_name.c_str(), FileFlags::FILE_FLAGS_READ,
+			                                           FileLockType::NO_LOCK, options.compression);
+		}
+		file_handle = make_uniq<JSONFileHandle>(std::move(regular_file_handle), BufferAllocator::Get(context),
+		                                        std::move(gzip_blocks));
 	}
 	Reset();
 }
@@ -12,6 +12,7 @@
 #include "duckdb/common/enum_util.hpp"
 #include "duckdb/common/enums/file_compression_type.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/gzip_file_system.hpp"
 #include "duckdb/common/multi_file_reader.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "json_common.hpp"
@@ -53,7 +54,8 @@ public:
 
 struct JSONFileHandle {
 public:
-	JSONFileHandle(unique_ptr<FileHandle> file_handle, Allocator &allocator);
+	JSONFileHandle(unique_ptr<FileHandle> file_handle, Allocator &allocator,
+	               vector<GZipBlock> gzip_blocks = vector<GZipBlock>());
 
 	bool IsOpen() const;
 	void Close();
@@ -73,11 +75,15 @@ public:
 private:
 	idx_t ReadInternal(char *pointer, const idx_t requested_size);
 	idx_t ReadFromCache(char *&pointer, idx_t &size, idx_t &position);
+	void ReadFromGZipBlocks(char *pointer, idx_t size, idx_t position);
 
 private:
 	//! The JSON file handle
 	unique_ptr<FileHandle> file_handle;
 	Allocator &allocator;
+	//! Index of the members of a BGZF-compressed file, if the file is read through its index
+	//! The members are decompressed independently, which allows reading the file in parallel
+	const vector<GZipBlock> gzip_blocks;
 
 	//! File properties
 	const bool can_seek;
@@ -228,6 +228,7 @@ private:
 	void ParseNextChunk();
 
 	void ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
+	yyjson_doc *ParseProjectedKeys(const char *const json_start, const idx_t json_size);
 	void ThrowObjectSizeError(const idx_t object_size);
 	void ThrowInvalidAtEndError();
 
@@ -255,6 +256,9 @@ private:
 
 	//! Buffer to reconstruct split values
 	AllocatedData reconstruct_buffer;
+
+	//! If not empty, only these keys of the records are parsed, the values of other keys are skipped
+	json_key_set_t projected_keys;
 };
 
 struct JSONGlobalTableFunctionState : public GlobalTableFunctionState {
@@ -35,6 +35,9 @@ public:
 	void RefineCandidateTypes(yyjson_val *vals[], idx_t count, Vector &string_vector, ArenaAllocator &allocator,
 	                          DateFormatMap &date_format_map);
 
+	//! Merges the structure of another node (detected on a different sample) into this node
+	void Merge(JSONStructureNode &other);
+
 private:
 	void RefineCandidateTypesArray(yyjson_val *vals[], idx_t count, Vector &string_vector, ArenaAllocator &allocator,
 	                               DateFormatMap &date_format_map);
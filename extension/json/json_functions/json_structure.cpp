@@ -262,6 +262,52 @@ void JSONStructureNode::EliminateCandidateTypes(idx_t count, Vector &string_vect
 	}
 }
 
+void JSONStructureNode::Merge(JSONStructureNode &other) {
+	initialized = initialized || other.initialized;
+	for (auto &other_desc : other.descriptions) {
+		bool existed = false;
+		for (auto &desc : descriptions) {
+			if (desc.type == other_desc.type) {
+				existed = true;
+				break;
+			}
+		}
+		auto &desc = GetOrCreateDescription(other_desc.type);
+		if (desc.type != other_desc.type) {
+			// Merged into a wider numeric type, or a NULL that was not added
+			continue;
+		}
+		switch (desc.type) {
+		case LogicalTypeId::LIST:
+			D_ASSERT(other_desc.children.size() == 1);
+			desc.GetOrCreateChild().Merge(other_desc.children[0]);
+			break;
+		case LogicalTypeId::STRUCT:
+			for (auto &other_child : other_desc.children) {
+				D_ASSERT(other_child.key);
+				JSONKey key {other_child.key->c_str(), other_child.key->length()};
+				auto it = desc.key_map.find(key);
+				if (it == desc.key_map.end()) {
+					// The key points to the string owned by the child, which does not move
+					desc.key_map.emplace(key, desc.children.size());
+					desc.children.push_back(std::move(other_child));
+				} else {
+					desc.children[it->second].Merge(other_child);
+				}
+			}
+			break;
+		case LogicalTypeId::VARCHAR:
+			// Candidate types are eliminated from back to front, so the shorter list eliminated the most types
+			if (!existed || other_desc.candidate_types.size() < desc.candidate_types.size()) {
+				desc.candidate_types = std::move(other_desc.candidate_types);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
 template <class OP, class T>
 bool TryParse(Vector &string_vector, StrpTimeFormat &format, const idx_t count) {
 	const auto strings = FlatVector::GetData<string_t>(string_vector);
@@ -1,67 +1,210 @@
 #include "duckdb/common/multi_file_reader.hpp"
+#include "duckdb/common/preserved_error.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "json_functions.hpp"
 #include "json_scan.hpp"
 #include "json_structure.hpp"
 #include "json_transform.hpp"
 
-namespace duckdb {
+#include <condition_variable>
 
-void JSONScan::AutoDetect(ClientContext &context, JSONScanData &bind_data, vector<LogicalType> &return_types,
-                          vector<string> &names) {
-	// Change scan type during detection
-	bind_data.type = JSONScanType::SAMPLE;
+namespace duckdb {
 
-	// These are used across files (if union_by_name)
-	JSONStructureNode node;
+//! Samples a single file, and merges the detected structure into "node"
+static void AutoDetectFile(ClientContext &context, JSONScanData &bind_data, BufferedJSONReader &reader,
+                           JSONStructureNode &node, DateFormatMap &date_format_map, idx_t &remaining) {
 	ArenaAllocator allocator(BufferAllocator::Get(context));
 	Vector string_vector(LogicalType::VARCHAR);
 
-	// Loop through the files (if union_by_name, else just sample the first file)
-	idx_t remaining = bind_data.sample_size;
-	for (idx_t file_idx = 0; file_idx < bind_data.files.size(); file_idx++) {
-		// Create global/local state and place the reader in the right field
-		JSONScanGlobalState gstate(context, bind_data);
-		JSONScanLocalState lstate(context, gstate);
-		if (file_idx == 0) {
-			gstate.json_readers.emplace_back(bind_data.initial_reader.get());
-		} else {
-			gstate.json_readers.emplace_back(bind_data.union_readers[file_idx - 1].get());
+	// Create global/local state and place the reader in the right field
+	JSONScanGlobalState gstate(context, bind_data);
+	JSONScanLocalState lstate(context, gstate);
+	gstate.json_readers.emplace_back(&reader);
+
+	// Read and detect schema
+	while (remaining != 0) {
+		allocator.Reset();
+		auto read_count = lstate.ReadNext(gstate);
+		if (read_count == 0) {
+			break;
+		}
+
+		idx_t next = MinValue<idx_t>(read_count, remaining);
+		for (idx_t i = 0; i < next; i++) {
+			const auto &val = lstate.values[i];
+			if (val) {
+				JSONStructure::ExtractStructure(val, node);
+			}
 		}
+		if (!node.ContainsVarchar()) { // Can't refine non-VARCHAR types
+			continue;
+		}
+		node.InitializeCandidateTypes(bind_data.max_depth);
+		node.RefineCandidateTypes(lstate.values, next, string_vector, allocator, date_format_map);
+		remaining -= next;
+	}
+
+	if (&reader == bind_data.initial_reader.get() && lstate.total_tuple_count != 0) {
+		bind_data.avg_tuple_size = lstate.total_read_size / lstate.total_tuple_count;
+	}
+}
+
+static BufferedJSONReader &GetAutoDetectReader(JSONScanData &bind_data, idx_t file_idx) {
+	return file_idx == 0 ? *bind_data.initial_reader : *bind_data.union_readers[file_idx - 1];
+}
 
-		// Read and detect schema
-		while (remaining != 0) {
-			allocator.Reset();
-			auto read_count = lstate.ReadNext(gstate);
-			if (read_count == 0) {
+//! The structure and date/timestamp formats that were detected in a single file
+struct JSONAutoDetectResult {
+	JSONStructureNode node;
+	DateFormatMap date_format_map;
+	PreservedError error;
+};
+
+struct JSONAutoDetectState {
+	explicit JSONAutoDetectState(idx_t file_count) : results(file_count), running_tasks(0) {
+	}
+
+	//! The result of each file
+	vector<JSONAutoDetectResult> results;
+
+	mutex lock;
+	//! Notified when the last running task has finished
+	std::condition_variable tasks_finished;
+	idx_t running_tasks;
+};
+
+//! Samples a range of files when auto-detecting with union_by_name
+class JSONAutoDetectTask : public Task {
+public:
+	JSONAutoDetectTask(ClientContext &context_p, JSONScanData &bind_data_p, JSONAutoDetectState &state_p,
+	                   idx_t file_idx_begin_p, idx_t file_idx_end_p)
+	    : context(context_p), bind_data(bind_data_p), state(state_p), file_idx_begin(file_idx_begin_p),
+	      file_idx_end(file_idx_end_p) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		for (idx_t file_idx = file_idx_begin; file_idx < file_idx_end; file_idx++) {
+			auto &result = state.results[file_idx];
+			result.node = JSONStructureNode();
+			result.date_format_map = bind_data.date_format_map;
+			auto &reader = GetAutoDetectReader(bind_data, file_idx);
+			try {
+				// The file may have been sampled before, with formats that turned out to be eliminated
+				reader.Reset();
+				// When union_by_name=true we sample sample_size per file
+				idx_t remaining = bind_data.sample_size;
+				AutoDetectFile(context, bind_data, reader, result.node, result.date_format_map, remaining);
+			} catch (Exception &ex) {
+				result.error = PreservedError(ex);
+			} catch (std::exception &ex) {
+				result.error = PreservedError(ex);
+			} catch (...) { // LCOV_EXCL_START
+				result.error = PreservedError("Unknown exception in JSON auto-detection");
+			} // LCOV_EXCL_STOP
+			if (result.error) {
 				break;
 			}
+		}
+		lock_guard<mutex> guard(state.lock);
+		if (--state.running_tasks == 0) {
+			state.tasks_finished.notify_one();
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
 
-			idx_t next = MinValue<idx_t>(read_count, remaining);
-			for (idx_t i = 0; i < next; i++) {
-				const auto &val = lstate.values[i];
-				if (val) {
-					JSONStructure::ExtractStructure(val, node);
-				}
+private:
+	ClientContext &context;
+	JSONScanData &bind_data;
+	JSONAutoDetectState &state;
+	const idx_t file_idx_begin;
+	const idx_t file_idx_end;
+};
+
+//! Samples files [file_idx_begin, file_idx_end) in parallel, each starting with the current date/timestamp formats
+static void SampleFiles(ClientContext &context, JSONScanData &bind_data, JSONAutoDetectState &state,
+                        idx_t file_idx_begin, idx_t file_idx_end) {
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	const auto file_count = file_idx_end - file_idx_begin;
+	const auto task_count = MinValue<idx_t>(scheduler.NumberOfThreads(), file_count);
+
+	state.running_tasks = task_count;
+	auto producer = scheduler.CreateProducer();
+	for (idx_t task_idx = 0; task_idx < task_count; task_idx++) {
+		const auto task_file_idx_begin = file_idx_begin + task_idx * file_count / task_count;
+		const auto task_file_idx_end = file_idx_begin + (task_idx + 1) * file_count / task_count;
+		scheduler.ScheduleTask(*producer, make_shared<JSONAutoDetectTask>(context, bind_data, state,
+		                                                                  task_file_idx_begin, task_file_idx_end));
+	}
+
+	// Help out executing the tasks, then wait for the tasks that were picked up by other threads
+	shared_ptr<Task> task;
+	while (scheduler.GetTaskFromProducer(*producer, task)) {
+		task->Execute(TaskExecutionMode::PROCESS_ALL);
+		task.reset();
+	}
+	unique_lock<mutex> guard(state.lock);
+	state.tasks_finished.wait(guard, [&state] { return state.running_tasks == 0; });
+}
+
+//! Date/timestamp formats are eliminated from back to front, so we only have to compare the number of formats
+static bool FormatsEliminated(DateFormatMap &before, DateFormatMap &after) {
+	for (const auto type : {LogicalTypeId::DATE, LogicalTypeId::TIMESTAMP}) {
+		if (before.HasFormats(type) &&
+		    before.GetCandidateFormats(type).size() != after.GetCandidateFormats(type).size()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//! When union_by_name=true we sample every file. Each file is sampled with the date/timestamp formats that are left
+//! after sampling the files before it, and the structures are merged in file order, so the detected schema does not
+//! depend on the number of threads. To sample files in parallel, we speculate that the files before them eliminate no
+//! formats. The files after a file that did eliminate formats are sampled again, in the next round
+static void UnionByNameAutoDetect(ClientContext &context, JSONScanData &bind_data, JSONStructureNode &node) {
+	const auto file_count = bind_data.files.size();
+	const auto parallel = TaskScheduler::GetScheduler(context).NumberOfThreads() > 1;
+
+	JSONAutoDetectState state(file_count);
+	idx_t file_idx = 0;
+	while (file_idx < file_count) {
+		// The first file usually eliminates formats that the other files do not, so we sample it by itself
+		const auto round_file_idx_end = file_idx == 0 || !parallel ? file_idx + 1 : file_count;
+		SampleFiles(context, bind_data, state, file_idx, round_file_idx_end);
+		while (file_idx < round_file_idx_end) {
+			auto &result = state.results[file_idx++];
+			if (result.error) {
+				result.error.Throw();
 			}
-			if (!node.ContainsVarchar()) { // Can't refine non-VARCHAR types
-				continue;
+			node.Merge(result.node);
+			const auto eliminated = FormatsEliminated(bind_data.date_format_map, result.date_format_map);
+			bind_data.date_format_map = std::move(result.date_format_map);
+			if (eliminated) {
+				break;
 			}
-			node.InitializeCandidateTypes(bind_data.max_depth);
-			node.RefineCandidateTypes(lstate.values, next, string_vector, allocator, bind_data.date_format_map);
-			remaining -= next;
 		}
+	}
+}
 
-		if (file_idx == 0 && lstate.total_tuple_count != 0) {
-			bind_data.avg_tuple_size = lstate.total_read_size / lstate.total_tuple_count;
-		}
+void JSONScan::AutoDetect(ClientContext &context, JSONScanData &bind_data, vector<LogicalType> &return_types,
+                          vector<string> &names) {
+	// Change scan type during detection
+	bind_data.type = JSONScanType::SAMPLE;
 
-		// Close the file and stop detection if not union_by_name
-		if (bind_data.options.file_options.union_by_name) {
-			// When union_by_name=true we sample sample_size per file
-			remaining = bind_data.sample_size;
-		} else if (remaining == 0) {
-			// When union_by_name=false, we sample sample_size in total (across the first files)
-			break;
+	// These are used across files (if union_by_name)
+	JSONStructureNode node;
+
+	if (bind_data.options.file_options.union_by_name) {
+		UnionByNameAutoDetect(context, bind_data, node);
+	} else {
+		// Loop through the files, when union_by_name=false we sample sample_size in total (across the first files)
+		idx_t remaining = bind_data.sample_size;
+		for (idx_t file_idx = 0; file_idx < bind_data.files.size(); file_idx++) {
+			AutoDetectFile(context, bind_data, GetAutoDetectReader(bind_data, file_idx), node,
+			               bind_data.date_format_map, remaining);
+			if (remaining == 0) {
+				break;
+			}
 		}
 	}
 
@@ -151,6 +151,14 @@ JSONScanLocalState::JSONScanLocalState(ClientContext &context, JSONScanGlobalSta
 
 	// Buffer to reconstruct JSON values when they cross a buffer boundary
 	reconstruct_buffer = gstate.allocator.Allocate(gstate.buffer_capacity);
+
+	// If we only read some of the columns, we only need to parse the values of those keys
+	if (bind_data.type == JSONScanType::READ_JSON && bind_data.options.record_type == JSONRecordType::RECORDS &&
+	    !gstate.names.empty() && gstate.names.size() < bind_data.names.size()) {
+		for (const auto &name : gstate.names) {
+			projected_keys.insert({name.c_str(), name.length()});
+		}
+	}
 }
 
 JSONGlobalTableFunctionState::JSONGlobalTableFunctionState(ClientContext &context, TableFunctionInitInput &input)
@@ -371,7 +379,341 @@ static inline void TrimWhitespace(JSONString &line) {
 	}
 }
 
+//! Skips whitespace the way yyjson does, which (unlike StringUtil::CharacterIsSpace) excludes '\v' and '\f'
+static inline void SkipJSONWhitespace(const char *ptr, idx_t &pos, const idx_t end) {
+	for (; pos != end; pos++) {
+		const auto &c = ptr[pos];
+		if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+			break;
+		}
+	}
+}
+
+//! Skips over the UTF-8 sequence starting at "pos", only accepting the shortest encoding of valid code points
+static inline bool SkipUTF8(const char *ptr, idx_t &pos, const idx_t end) {
+	const auto c = static_cast<uint8_t>(ptr[pos]);
+	idx_t extra_bytes;
+	uint8_t second_min = 0x80;
+	uint8_t second_max = 0xBF;
+	if (c >= 0xC2 && c <= 0xDF) {
+		extra_bytes = 1;
+	} else if (c >= 0xE0 && c <= 0xEF) {
+		extra_bytes = 2;
+		if (c == 0xE0) {
+			second_min = 0xA0; // overlong
+		} else if (c == 0xED) {
+			second_max = 0x9F; // surrogate
+		}
+	} else if (c >= 0xF0 && c <= 0xF4) {
+		extra_bytes = 3;
+		if (c == 0xF0) {
+			second_min = 0x90; // overlong
+		} else if (c == 0xF4) {
+			second_max = 0x8F; // larger than U+10FFFF
+		}
+	} else {
+		return false;
+	}
+	if (end - pos <= extra_bytes) {
+		return false;
+	}
+	const auto second = static_cast<uint8_t>(ptr[pos + 1]);
+	if (second < second_min || second > second_max) {
+		return false;
+	}
+	for (idx_t i = 2; i <= extra_bytes; i++) {
+		if ((static_cast<uint8_t>(ptr[pos + i]) & 0xC0) != 0x80) {
+			return false;
+		}
+	}
+	pos += extra_bytes + 1;
+	return true;
+}
+
+//! Skips over the string starting at "pos", checking its escapes, control characters and UTF-8 like yyjson does
+static inline bool SkipString(const char *ptr, idx_t &pos, const idx_t end, bool &escaped) {
+	D_ASSERT(ptr[pos] == '"');
+	pos++;
+	while (pos < end) {
+		const auto c = static_cast<uint8_t>(ptr[pos]);
+		if (c == '"') {
+			pos++;
+			return true;
+		}
+		if (c < 0x20) {
+			return false;
+		}
+		if (c >= 0x80) {
+			if (!SkipUTF8(ptr, pos, end)) {
+				return false;
+			}
+			continue;
+		}
+		if (c != '\\') {
+			pos++;
+			continue;
+		}
+		escaped = true;
+		if (++pos == end) {
+			return false;
+		}
+		switch (ptr[pos]) {
+		case '"':
+		case '\\':
+		case '/':
+		case 'b':
+		case 'f':
+		case 'n':
+		case 'r':
+		case 't':
+			pos++;
+			break;
+		case 'u': {
+			if (end - pos <= 4) {
+				return false;
+			}
+			uint16_t code_unit = 0;
+			for (idx_t i = 1; i <= 4; i++) {
+				const auto &h = ptr[pos + i];
+				if (!StringUtil::CharacterIsHex(h)) {
+					return false;
+				}
+				code_unit = (code_unit << 4) | StringUtil::GetHexValue(h);
+			}
+			if ((code_unit & 0xF800) == 0xD800) {
+				// Surrogate pairs are rare, leave them to yyjson
+				return false;
+			}
+			pos += 5;
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+	return false;
+}
+
+//! Skips over the number starting at "pos", only accepting the strict JSON grammar
+static inline bool SkipNumber(const char *ptr, idx_t &pos, const idx_t end) {
+	if (pos != end && ptr[pos] == '-') {
+		pos++;
+	}
+	if (pos == end || !StringUtil::CharacterIsDigit(ptr[pos])) {
+		return false;
+	}
+	if (ptr[pos++] != '0') {
+		while (pos != end && StringUtil::CharacterIsDigit(ptr[pos])) {
+			pos++;
+		}
+	}
+	if (pos != end && ptr[pos] == '.') {
+		pos++;
+		if (pos == end || !StringUtil::CharacterIsDigit(ptr[pos])) {
+			return false;
+		}
+		while (pos != end && StringUtil::CharacterIsDigit(ptr[pos])) {
+			pos++;
+		}
+	}
+	if (pos != end && (ptr[pos] == 'e' || ptr[pos] == 'E')) {
+		pos++;
+		if (pos != end && (ptr[pos] == '-' || ptr[pos] == '+')) {
+			pos++;
+		}
+		if (pos == end || !StringUtil::CharacterIsDigit(ptr[pos])) {
+			return false;
+		}
+		while (pos != end && StringUtil::CharacterIsDigit(ptr[pos])) {
+			pos++;
+		}
+	}
+	return true;
+}
+
+static inline bool SkipLiteral(const char *ptr, idx_t &pos, const idx_t end, const char *literal, idx_t length) {
+	if (end - pos < length || memcmp(ptr + pos, literal, length) != 0) {
+		return false;
+	}
+	pos += length;
+	return true;
+}
+
+//! Skips over a key and the colon that follows it
+static inline bool SkipKey(const char *ptr, idx_t &pos, const idx_t end) {
+	bool escaped = false;
+	if (pos == end || ptr[pos] != '"' || !SkipString(ptr, pos, end, escaped)) {
+		return false;
+	}
+	SkipJSONWhitespace(ptr, pos, end);
+	if (pos == end || ptr[pos] != ':') {
+		return false;
+	}
+	pos++;
+	return true;
+}
+
+//! Skips over the value starting at "pos" without parsing it. The value is validated while skipping, but not
+//! everything yyjson accepts is accepted here (e.g., NaN, trailing commas, or deep nesting): in that case we return
+//! false, and the whole record is parsed by yyjson, which also reports any errors
+static inline bool SkipValue(const char *ptr, idx_t &pos, const idx_t end) {
+	static constexpr idx_t MAX_DEPTH = 64;
+	//! Whether the enclosing containers are objects (or arrays)
+	bool in_object[MAX_DEPTH];
+	idx_t depth = 0;
+	while (true) {
+		// Skip a single value
+		SkipJSONWhitespace(ptr, pos, end);
+		if (pos == end) {
+			return false;
+		}
+		bool success;
+		switch (ptr[pos]) {
+		case '"': {
+			bool escaped = false;
+			success = SkipString(ptr, pos, end, escaped);
+			break;
+		}
+		case '{':
+		case '[': {
+			const bool is_object = ptr[pos++] == '{';
+			SkipJSONWhitespace(ptr, pos, end);
+			if (pos != end && ptr[pos] == (is_object ? '}' : ']')) {
+				pos++;
+				success = true;
+				break;
+			}
+			if (depth == MAX_DEPTH || (is_object && !SkipKey(ptr, pos, end))) {
+				return false;
+			}
+			in_object[depth++] = is_object;
+			continue;
+		}
+		case 't':
+			success = SkipLiteral(ptr, pos, end, "true", 4);
+			break;
+		case 'f':
+			success = SkipLiteral(ptr, pos, end, "false", 5);
+			break;
+		case 'n':
+			success = SkipLiteral(ptr, pos, end, "null", 4);
+			break;
+		default:
+			success = SkipNumber(ptr, pos, end);
+			break;
+		}
+		if (!success) {
+			return false;
+		}
+
+		// Close the containers that end after this value, until we find the next value
+		while (true) {
+			if (depth == 0) {
+				return true;
+			}
+			SkipJSONWhitespace(ptr, pos, end);
+			if (pos == end) {
+				return false;
+			}
+			const auto is_object = in_object[depth - 1];
+			if (ptr[pos] == ',') {
+				pos++;
+				SkipJSONWhitespace(ptr, pos, end);
+				if (is_object && !SkipKey(ptr, pos, end)) {
+					return false;
+				}
+				break;
+			}
+			if (ptr[pos] != (is_object ? '}' : ']')) {
+				return false;
+			}
+			pos++;
+			depth--;
+		}
+	}
+}
+
+yyjson_doc *JSONScanLocalState::ParseProjectedKeys(const char *const json_start, const idx_t json_size) {
+	// Copy only the key/value pairs we need into a new (smaller) object, and parse that instead.
+	// If we encounter anything unexpected we return nullptr, and parse the whole record as usual
+	idx_t pos = 0;
+	SkipJSONWhitespace(json_start, pos, json_size);
+	if (pos == json_size || json_start[pos] != '{') {
+		return nullptr;
+	}
+	pos++;
+
+	auto alc = allocator.GetYYAlc();
+	auto projected = char_ptr_cast(alc->malloc(alc->ctx, json_size + YYJSON_PADDING_SIZE));
+	idx_t projected_size = 0;
+	projected[projected_size++] = '{';
+	while (true) {
+		SkipJSONWhitespace(json_start, pos, json_size);
+		if (pos == json_size) {
+			return nullptr;
+		}
+		if (json_start[pos] == '}') {
+			break;
+		}
+		if (json_start[pos] != '"') {
+			return nullptr;
+		}
+		const auto key_start = pos;
+		bool escaped = false;
+		if (!SkipString(json_start, pos, json_size, escaped) || escaped) {
+			return nullptr;
+		}
+		const JSONKey key {json_start + key_start + 1, pos - key_start - 2};
+		SkipJSONWhitespace(json_start, pos, json_size);
+		if (pos == json_size || json_start[pos] != ':') {
+			return nullptr;
+		}
+		pos++;
+		SkipJSONWhitespace(json_start, pos, json_size);
+		if (pos == json_size || !SkipValue(json_start, pos, json_size)) {
+			return nullptr;
+		}
+		if (projected_keys.find(key) != projected_keys.end()) {
+			if (projected_size != 1) {
+				projected[projected_size++] = ',';
+			}
+			const auto pair_size = pos - key_start;
+			memcpy(projected + projected_size, json_start + key_start, pair_size);
+			projected_size += pair_size;
+		}
+		SkipJSONWhitespace(json_start, pos, json_size);
+		if (pos == json_size) {
+			return nullptr;
+		}
+		if (json_start[pos] == ',') {
+			pos++;
+		} else if (json_start[pos] != '}') {
+			return nullptr;
+		}
+	}
+	pos++;
+	SkipJSONWhitespace(json_start, pos, json_size);
+	if (pos != json_size) {
+		return nullptr;
+	}
+	projected[projected_size++] = '}';
+	memset(projected + projected_size, 0, YYJSON_PADDING_SIZE);
+
+	return JSONCommon::ReadDocumentUnsafe(projected, projected_size, JSONCommon::READ_INSITU_FLAG, alc);
+}
+
 void JSONScanLocalState::ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining) {
+	if (!projected_keys.empty()) {
+		auto projected_doc = ParseProjectedKeys(json_start, json_size);
+		if (projected_doc) {
+			lines_or_objects_in_buffer++;
+			units[scan_count] = JSONString(json_start, json_size);
+			TrimWhitespace(units[scan_count]);
+			values[scan_count] = projected_doc->root;
+			return;
+		}
+	}
+
 	yyjson_doc *doc;
 	yyjson_read_err err;
 	if (bind_data.type == JSONScanType::READ_JSON_OBJECTS) { // If we return strings, we cannot parse INSITU
@@ -217,6 +217,9 @@ void ColumnReader::DeltaByteArray(uint8_t *defines, idx_t num_values, // NOLINT
 
 void ColumnReader::DictReference(Vector &result) {
 }
+bool ColumnReader::DictionarySlice(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) { // NOLINT
+	return false;
+}
 void ColumnReader::PlainReference(shared_ptr<ByteBuffer>, Vector &result) { // NOLINT
 }
 
@@ -238,6 +241,9 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	// any state left over from the previous row group is no longer relevant
+	page_rows_available = 0;
+	pending_skips = 0;
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -508,9 +514,13 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr
 		if (dict_decoder) {
 			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * (read_now - null_count));
 			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, read_now - null_count);
-			DictReference(result);
-			Offsets(reinterpret_cast<uint32_t *>(offset_buffer.ptr), define_out, read_now, filter, result_offset,
-			        result);
+			auto offsets = reinterpret_cast<uint32_t *>(offset_buffer.ptr);
+			// if all values come from this page we can reference the dictionary instead of copying from it
+			if (!emit_dictionary_vectors || read_now != num_values ||
+			    !DictionarySlice(offsets, define_out, read_now, result)) {
+				DictReference(result);
+				Offsets(offsets, define_out, read_now, filter, result_offset, result);
+			}
 		} else if (dbp_decoder) {
 			// TODO keep this in the state
 			auto read_buf = make_shared<ResizeableBuffer>();
@@ -578,17 +588,59 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (HasRepeats() || page_rows_available > 0) {
+		// for repeated columns the page value count does not correspond to the row count
+		return 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	idx_t skipped = 0;
+	while (skipped < num_values) {
+		trans.SetLocation(chunk_read_offset);
+		PageHeader page_hdr;
+		page_hdr.read(protocol);
+
+		idx_t page_values;
+		if (page_hdr.type == PageType::DATA_PAGE && page_hdr.__isset.data_page_header) {
+			page_values = page_hdr.data_page_header.num_values;
+		} else if (page_hdr.type == PageType::DATA_PAGE_V2 && page_hdr.__isset.data_page_header_v2) {
+			page_values = page_hdr.data_page_header_v2.num_values;
+		} else if (page_hdr.type == PageType::DICTIONARY_PAGE) {
+			// the dictionary is needed by subsequent pages, so we cannot skip it
+			trans.SetLocation(chunk_read_offset);
+			PrepareRead(none_filter);
+			chunk_read_offset = trans.GetLocation();
+			continue;
+		} else {
+			break;
+		}
+		if (page_values > num_values - skipped) {
+			// the page is only partially skipped, it has to be decoded
+			break;
+		}
+		// the entire page is skipped: jump over it without reading or decompressing it
+		chunk_read_offset = trans.GetLocation() + page_hdr.compressed_page_size;
+		skipped += page_values;
+	}
+	trans.SetLocation(chunk_read_offset);
+	group_rows_available -= skipped;
+	return skipped;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	// first skip over whole pages without decoding them
+	auto skipped = SkipPages(num_values);
+	idx_t remaining = num_values - skipped;
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
 	// TODO this can be optimized, for example we dont actually have to bitunpack offsets
 	Vector dummy_result(type, nullptr);
 
-	idx_t remaining = num_values;
-	idx_t read = 0;
+	idx_t read = skipped;
 
 	while (remaining) {
 		idx_t to_read = MinValue<idx_t>(remaining, STANDARD_VECTOR_SIZE);
@@ -637,7 +689,9 @@ uint32_t StringColumnReader::VerifyString(const char *str_data, uint32_t str_len
 
 void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num_entries) {
 	dict = std::move(data);
-	dict_strings = unique_ptr<string_t[]>(new string_t[num_entries]);
+	dictionary_size = num_entries;
+	dictionary = make_uniq<Vector>(Type(), num_entries + 1);
+	auto dict_strings = FlatVector::GetData<string_t>(*dictionary);
 	for (idx_t dict_idx = 0; dict_idx < num_entries; dict_idx++) {
 		uint32_t str_len;
 		if (fixed_width_string_length == 0) {
@@ -654,6 +708,9 @@ void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num
 		dict_strings[dict_idx] = string_t(dict_str, actual_str_len);
 		dict->inc(str_len);
 	}
+	// the last entry is used for NULL values when slicing the dictionary
+	FlatVector::SetNull(*dictionary, num_entries, true);
+	DictReference(*dictionary);
 }
 
 static shared_ptr<ResizeableBuffer> ReadDbpData(Allocator &allocator, ResizeableBuffer &buffer, idx_t &value_count) {
@@ -764,13 +821,34 @@ private:
 void StringColumnReader::DictReference(Vector &result) {
 	StringVector::AddBuffer(result, make_buffer<ParquetStringVectorBuffer>(dict));
 }
+bool StringColumnReader::DictionarySlice(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) {
+	if (!dictionary) {
+		return false;
+	}
+	SelectionVector sel(num_values);
+	idx_t offset_idx = 0;
+	for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+		if (HasDefines() && defines[row_idx] != max_define) {
+			sel.set_index(row_idx, dictionary_size);
+			continue;
+		}
+		auto offset = offsets[offset_idx++];
+		if (offset >= dictionary_size) {
+			throw std::runtime_error("Parquet file is likely corrupted, dictionary offset out of range");
+		}
+		sel.set_index(row_idx, offset);
+	}
+	result.Slice(*dictionary, sel, num_values);
+	return true;
+}
+
 void StringColumnReader::PlainReference(shared_ptr<ByteBuffer> plain_data, Vector &result) {
 	StringVector::AddBuffer(result, make_buffer<ParquetStringVectorBuffer>(std::move(plain_data)));
 }
 
 string_t StringParquetValueConversion::DictRead(ByteBuffer &dict, uint32_t &offset, ColumnReader &reader) {
-	auto &dict_strings = reader.Cast<StringColumnReader>().dict_strings;
-	return dict_strings[offset];
+	auto &dictionary = *reader.Cast<StringColumnReader>().dictionary;
+	return FlatVector::GetData<string_t>(dictionary)[offset];
 }
 
 string_t StringParquetValueConversion::PlainRead(ByteBuffer &plain_data, ColumnReader &reader) {
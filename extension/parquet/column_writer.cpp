@@ -360,6 +360,7 @@ public:
 	void Prepare(ColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) override;
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinalizePages(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 
 protected:
@@ -649,13 +650,22 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 	}
 }
 
-void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void BasicColumnWriter::FinalizePages(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
-	auto &column_chunk = state.row_group.columns[state.col_idx];
 
 	// flush the last page (if any remains)
 	FlushPage(state);
 
+	// compress the dictionary page - this inserts it as the first page to write
+	if (HasDictionary(state)) {
+		FlushDictionary(state, state.stats_state.get());
+	}
+}
+
+void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<BasicColumnWriterState>();
+	auto &column_chunk = state.row_group.columns[state.col_idx];
+
 	auto &column_writer = writer.GetWriter();
 	auto start_offset = column_writer.GetTotalWritten();
 	auto page_offset = start_offset;
@@ -665,7 +675,6 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		column_chunk.meta_data.statistics.__isset.distinct_count = true;
 		column_chunk.meta_data.dictionary_page_offset = page_offset;
 		column_chunk.meta_data.__isset.dictionary_page_offset = true;
-		FlushDictionary(state, state.stats_state.get());
 		page_offset += state.write_info[0].compressed_size;
 	}
 
@@ -1567,6 +1576,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinalizePages(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1656,6 +1666,13 @@ void StructColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 	}
 }
 
+void StructColumnWriter::FinalizePages(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<StructColumnWriterState>();
+	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
+		child_writers[child_idx]->FinalizePages(*state.child_states[child_idx]);
+	}
+}
+
 void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<StructColumnWriterState>();
 	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
@@ -1688,6 +1705,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinalizePages(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1796,6 +1814,11 @@ void ListColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t c
 	child_writer->Write(*state.child_state, child_list, child_length);
 }
 
+void ListColumnWriter::FinalizePages(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<ListColumnWriterState>();
+	child_writer->FinalizePages(*state.child_state);
+}
+
 void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<ListColumnWriterState>();
 	child_writer->FinalizeWrite(*state.child_state);
@@ -55,6 +55,11 @@ public:
 
 	virtual void Skip(idx_t num_values);
 
+	//! Allow dictionary-encoded pages to be emitted as a dictionary vector instead of materializing every value
+	void SetEmitDictionaryVectors(bool emit) {
+		emit_dictionary_vectors = emit;
+	}
+
 	ParquetReader &Reader();
 	const LogicalType &Type() const;
 	const SchemaElement &Schema() const;
@@ -101,6 +106,8 @@ protected:
 
 	// these are nops for most types, but not for strings
 	virtual void DictReference(Vector &result);
+	// slices the dictionary into the result instead of materializing it, returns false if this is not supported
+	virtual bool DictionarySlice(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result);
 	virtual void PlainReference(shared_ptr<ByteBuffer>, Vector &result);
 
 	virtual void PrepareDeltaLengthByteArray(ResizeableBuffer &buffer);
@@ -132,6 +139,7 @@ protected:
 	idx_t byte_array_count = 0;
 
 	idx_t pending_skips = 0;
+	bool emit_dictionary_vectors = false;
 
 	virtual void ResetPage();
 
@@ -139,6 +147,8 @@ private:
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
 	void PrepareRead(parquet_filter_t &filter);
+	// skips as many whole data pages as possible without decompressing them, returns the number of skipped values
+	idx_t SkipPages(idx_t num_values);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
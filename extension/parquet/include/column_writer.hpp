@@ -106,6 +106,10 @@ public:
 
 	virtual void BeginWrite(ColumnWriterState &state) = 0;
 	virtual void Write(ColumnWriterState &state, Vector &vector, idx_t count) = 0;
+	//! Called after all data has been passed to Write - flushes and compresses any remaining pages. This does not
+	//! touch the file, so it can run concurrently for different row groups
+	virtual void FinalizePages(ColumnWriterState &state) = 0;
+	//! Writes the (compressed) pages to the file - row groups are written one at a time and in order
 	virtual void FinalizeWrite(ColumnWriterState &state) = 0;
 
 protected:
@@ -28,7 +28,9 @@ public:
 	StringColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t schema_idx_p,
 	                   idx_t max_define_p, idx_t max_repeat_p);
 
-	unique_ptr<string_t[]> dict_strings;
+	//! The dictionary of the current column chunk, with an additional NULL entry at position dictionary_size
+	unique_ptr<Vector> dictionary;
+	idx_t dictionary_size = 0;
 	idx_t fixed_width_string_length;
 	idx_t delta_offset = 0;
 
@@ -44,6 +46,7 @@ public:
 
 protected:
 	void DictReference(Vector &result) override;
+	bool DictionarySlice(uint32_t *offsets, uint8_t *defines, idx_t num_values, Vector &result) override;
 	void PlainReference(shared_ptr<ByteBuffer> plain_data, Vector &result) override;
 };
 
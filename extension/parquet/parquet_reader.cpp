@@ -629,6 +629,17 @@ void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t>
 
 	state.thrift_file_proto = CreateThriftProtocol(allocator, *state.file_handle, state.prefetch_mode);
 	state.root_reader = CreateReader();
+	// columns that are not filtered on can be emitted as dictionary vectors: filters need flat vectors
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		if (reader_data.filters) {
+			auto &filters = reader_data.filters->filters;
+			if (filters.find(reader_data.column_mapping[col_idx]) != filters.end()) {
+				continue;
+			}
+		}
+		root_reader.GetChildReader(reader_data.column_ids[col_idx])->SetEmitDictionaryVectors(true);
+	}
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 }
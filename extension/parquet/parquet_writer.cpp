@@ -417,6 +417,11 @@ void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGro
 			}
 		}
 
+		// compress any remaining pages here, so that FlushRowGroup only has to write them to the file
+		for (idx_t i = 0; i < next; i++) {
+			col_writers[i].get().FinalizePages(*write_states[i]);
+		}
+
 		for (auto &write_state : write_states) {
 			states.push_back(std::move(write_state));
 		}
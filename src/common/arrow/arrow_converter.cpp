@@ -129,7 +129,9 @@ void SetArrowFormat(DuckDBArrowSchemaHolder &root_holder, ArrowSchema &child, co
 		break;
 	case LogicalTypeId::UUID:
 	case LogicalTypeId::VARCHAR:
-		if (options.arrow_offset_size == ArrowOffsetSize::LARGE) {
+		if (type.id() == LogicalTypeId::VARCHAR && options.produce_arrow_string_view) {
+			child.format = "vu";
+		} else if (options.arrow_offset_size == ArrowOffsetSize::LARGE) {
 			child.format = "U";
 		} else {
 			child.format = "u";
@@ -179,7 +181,9 @@ void SetArrowFormat(DuckDBArrowSchemaHolder &root_holder, ArrowSchema &child, co
 	}
 	case LogicalTypeId::BLOB:
 	case LogicalTypeId::BIT: {
-		if (options.arrow_offset_size == ArrowOffsetSize::LARGE) {
+		if (options.produce_arrow_string_view) {
+			child.format = "vz";
+		} else if (options.arrow_offset_size == ArrowOffsetSize::LARGE) {
 			child.format = "Z";
 		} else {
 			child.format = "z";
@@ -4,6 +4,7 @@
 #include "duckdb/common/assert.hpp"
 #include "duckdb/common/exception.hpp"
 
+#include "duckdb/main/arrow_query_result.hpp"
 #include "duckdb/main/stream_query_result.hpp"
 
 #include "duckdb/common/arrow/result_arrow_wrapper.hpp"
@@ -117,6 +118,18 @@ int ResultArrowArrayStreamWrapper::MyStreamGetNext(struct ArrowArrayStream *stre
 		my_stream->column_types = result.types;
 		my_stream->column_names = result.names;
 	}
+	if (result.type == QueryResultType::ARROW_RESULT) {
+		// the result was already converted while it was collected, we hand out the arrays as they are
+		auto &arrays = result.Cast<ArrowQueryResult>().Arrays();
+		if (my_stream->array_index >= arrays.size()) {
+			out->release = nullptr;
+			return 0;
+		}
+		auto &array = arrays[my_stream->array_index++]->arrow_array;
+		*out = array;
+		array.release = nullptr;
+		return 0;
+	}
 	idx_t result_count;
 	PreservedError error;
 	if (!ArrowUtil::TryFetchChunk(scan_state, result.client_properties, my_stream->batch_size, out, result_count,
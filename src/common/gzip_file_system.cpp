@@ -377,6 +377,70 @@ string GZipFileSystem::UncompressGZIPString(const string &in) {
 	return decompressed;
 }
 
+static bool TryReadBGZFBlockSize(const uint8_t *hdr, idx_t &block_size) {
+	if (hdr[0] != 0x1F || hdr[1] != 0x8B || hdr[2] != GZIP_COMPRESSION_DEFLATE || hdr[3] != GZIP_FLAG_EXTRA) {
+		return false;
+	}
+	idx_t xlen = hdr[10] | hdr[11] << 8;
+	if (xlen != BGZF_EXTRA_SIZE || hdr[12] != 'B' || hdr[13] != 'C' || (hdr[14] | hdr[15] << 8) != 2) {
+		return false;
+	}
+	block_size = idx_t(hdr[16] | hdr[17] << 8) + 1;
+	return block_size >= BGZF_HEADER_SIZE + GZIP_FOOTER_SIZE;
+}
+
+bool GZipFileSystem::TryIndexBlocks(FileHandle &handle, vector<GZipBlock> &blocks) {
+	blocks.clear();
+	idx_t file_size = handle.GetFileSize();
+	if (file_size < BGZF_HEADER_SIZE) {
+		return false;
+	}
+	// every read fetches the footer of the previous member together with the header of the next one
+	uint8_t buffer[GZIP_FOOTER_SIZE + BGZF_HEADER_SIZE];
+	auto hdr = buffer + GZIP_FOOTER_SIZE;
+	handle.Read(hdr, BGZF_HEADER_SIZE, 0);
+
+	idx_t compressed_offset = 0;
+	idx_t uncompressed_offset = 0;
+	while (true) {
+		idx_t block_size;
+		if (!TryReadBGZFBlockSize(hdr, block_size) || compressed_offset + block_size > file_size) {
+			blocks.clear();
+			return false;
+		}
+		auto next_offset = compressed_offset + block_size;
+		auto read_size = MinValue<idx_t>(sizeof(buffer), file_size - next_offset + GZIP_FOOTER_SIZE);
+		handle.Read(buffer, read_size, next_offset - GZIP_FOOTER_SIZE);
+		idx_t uncompressed_size = Load<uint32_t>(buffer + GZIP_FOOTER_SIZE - sizeof(uint32_t));
+		if (uncompressed_size > 0) {
+			blocks.push_back(GZipBlock {compressed_offset, block_size, uncompressed_offset, uncompressed_size});
+			uncompressed_offset += uncompressed_size;
+		}
+		compressed_offset = next_offset;
+		if (compressed_offset == file_size) {
+			return true;
+		}
+		if (read_size < sizeof(buffer)) {
+			// trailing data that is not a complete member
+			blocks.clear();
+			return false;
+		}
+	}
+}
+
+void GZipFileSystem::UncompressBlock(const GZipBlock &block, const_data_ptr_t compressed, data_ptr_t out) {
+	idx_t block_size;
+	if (!TryReadBGZFBlockSize(compressed, block_size) || block_size != block.compressed_size) {
+		throw IOException("Input is not a BGZF block");
+	}
+	auto data = compressed + BGZF_HEADER_SIZE;
+	auto data_size = block.compressed_size - BGZF_HEADER_SIZE - GZIP_FOOTER_SIZE;
+	auto result = duckdb_miniz::tinfl_decompress_mem_to_mem(out, block.uncompressed_size, data, data_size, 0);
+	if (result != block.uncompressed_size) {
+		throw IOException("Failed to decode gzip block at offset %llu", block.compressed_offset);
+	}
+}
+
 unique_ptr<FileHandle> GZipFileSystem::OpenCompressedFile(unique_ptr<FileHandle> handle, bool write) {
 	auto path = handle->path;
 	return make_uniq<GZipFile>(std::move(handle), path, write);
@@ -86,14 +86,16 @@ int Comparators::BreakBlobTie(const idx_t &tie_col, const SBScanState &left, con
 		// Store heap pointers
 		data_ptr_t l_heap_ptr = left.HeapPtr(*left.sb->blob_sorting_data);
 		data_ptr_t r_heap_ptr = right.HeapPtr(*right.sb->blob_sorting_data);
-		// Unswizzle offset to pointer
-		UnswizzleSingleValue(l_data_ptr, l_heap_ptr, type);
-		UnswizzleSingleValue(r_data_ptr, r_heap_ptr, type);
+		// Unswizzle offset to pointer in copies of the values: other threads may read the rows at the same time
+		data_t l_value[sizeof(string_t)];
+		data_t r_value[sizeof(string_t)];
+		const idx_t value_size = type.InternalType() == PhysicalType::VARCHAR ? sizeof(string_t) : sizeof(data_ptr_t);
+		memcpy(l_value, l_data_ptr, value_size);
+		memcpy(r_value, r_data_ptr, value_size);
+		UnswizzleSingleValue(l_value, l_heap_ptr, type);
+		UnswizzleSingleValue(r_value, r_heap_ptr, type);
 		// Compare
-		result = CompareVal(l_data_ptr, r_data_ptr, type);
-		// Swizzle the pointers back to offsets
-		SwizzleSingleValue(l_data_ptr, l_heap_ptr, type);
-		SwizzleSingleValue(r_data_ptr, r_heap_ptr, type);
+		result = CompareVal(l_value, r_value, type);
 	} else {
 		result = CompareVal(l_data_ptr, r_data_ptr, type);
 	}
@@ -371,11 +373,4 @@ void Comparators::UnswizzleSingleValue(data_ptr_t data_ptr, const data_ptr_t &he
 	Store<data_ptr_t>(heap_ptr + Load<idx_t>(data_ptr), data_ptr);
 }
 
-void Comparators::SwizzleSingleValue(data_ptr_t data_ptr, const data_ptr_t &heap_ptr, const LogicalType &type) {
-	if (type.InternalType() == PhysicalType::VARCHAR) {
-		data_ptr += string_t::HEADER_SIZE;
-	}
-	Store<idx_t>(Load<data_ptr_t>(data_ptr) - heap_ptr, data_ptr);
-}
-
 } // namespace duckdb
@@ -9,14 +9,9 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 }
 
 void MergeSorter::PerformInMergeRound() {
-	while (true) {
-		{
-			lock_guard<mutex> pair_guard(state.lock);
-			if (state.pair_idx == state.num_pairs) {
-				break;
-			}
-			GetNextPartition();
-		}
+	while (ClaimNextPartition()) {
+		// the boundaries of the partition are found without holding the lock
+		GetPartition();
 		MergePartition();
 	}
 }
@@ -81,66 +76,98 @@ void MergeSorter::MergePartition() {
 #endif
 }
 
-void MergeSorter::GetNextPartition() {
+bool MergeSorter::ClaimNextPartition() {
+	lock_guard<mutex> pair_guard(state.lock);
+	if (state.pair_idx == state.num_pairs) {
+		return false;
+	}
+	pair_idx = state.pair_idx;
+	partition_idx = state.partition_idx;
+	auto &merge_path = state.merge_path_states[pair_idx];
+	merge_path.active_count++;
+	// The leading partitions that have been sliced bound the search for the boundaries of this partition
+	l_lower = merge_path.l_prefix;
+	r_lower = merge_path.r_prefix;
 	// Create result block
-	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
-	result = state.sorted_blocks_temp[state.pair_idx].back().get();
+	state.sorted_blocks_temp[pair_idx][partition_idx] = make_uniq<SortedBlock>(buffer_manager, state);
+	result = state.sorted_blocks_temp[pair_idx][partition_idx].get();
+	// Advance to the next partition
+	state.partition_idx++;
+	if (state.partition_idx == merge_path.partition_count) {
+		state.pair_idx++;
+		state.partition_idx = 0;
+	}
+	return true;
+}
+
+void MergeSorter::GetPartition() {
 	// Determine which blocks must be merged
-	auto &left_block = *state.sorted_blocks[state.pair_idx * 2];
-	auto &right_block = *state.sorted_blocks[state.pair_idx * 2 + 1];
-	const idx_t l_count = left_block.Count();
-	const idx_t r_count = right_block.Count();
+	auto &left_block = *state.sorted_blocks[pair_idx * 2];
+	auto &right_block = *state.sorted_blocks[pair_idx * 2 + 1];
 	// Initialize left and right reader
 	left = make_uniq<SBScanState>(buffer_manager, state);
 	right = make_uniq<SBScanState>(buffer_manager, state);
-	// Compute the work that this thread must do using Merge Path
+	left->sb = &left_block;
+	right->sb = &right_block;
+	// Compute the work that this thread must do using Merge Path: both boundaries of the partition are found
+	// independently of the other partitions, so partitions of the same pair are merged in parallel
+	idx_t l_start;
+	idx_t r_start;
 	idx_t l_end;
 	idx_t r_end;
-	if (state.l_start + state.r_start + state.block_capacity < l_count + r_count) {
-		left->sb = state.sorted_blocks[state.pair_idx * 2].get();
-		right->sb = state.sorted_blocks[state.pair_idx * 2 + 1].get();
-		const idx_t intersection = state.l_start + state.r_start + state.block_capacity;
-		GetIntersection(intersection, l_end, r_end);
-		D_ASSERT(l_end <= l_count);
-		D_ASSERT(r_end <= r_count);
-		D_ASSERT(intersection == l_end + r_end);
-	} else {
-		l_end = l_count;
-		r_end = r_count;
-	}
+	GetIntersection(partition_idx * state.block_capacity, l_start, r_start);
+	GetIntersection((partition_idx + 1) * state.block_capacity, l_end, r_end);
+	D_ASSERT(l_start <= l_end && l_end <= left_block.Count());
+	D_ASSERT(r_start <= r_end && r_end <= right_block.Count());
+	D_ASSERT(l_end + r_end ==
+	         MinValue((partition_idx + 1) * state.block_capacity, left_block.Count() + right_block.Count()));
 	// Create slices of the data that this thread must merge
 	left->SetIndices(0, 0);
 	right->SetIndices(0, 0);
-	left_input = left_block.CreateSlice(state.l_start, l_end, left->entry_idx);
-	right_input = right_block.CreateSlice(state.r_start, r_end, right->entry_idx);
+	left_input = left_block.CreateSlice(l_start, l_end, left->entry_idx);
+	right_input = right_block.CreateSlice(r_start, r_end, right->entry_idx);
 	left->sb = left_input.get();
 	right->sb = right_input.get();
-	state.l_start = l_end;
-	state.r_start = r_end;
-	D_ASSERT(left->Remaining() + right->Remaining() == state.block_capacity || (l_end == l_count && r_end == r_count));
-	// Update global state
-	if (state.l_start == l_count && state.r_start == r_count) {
-		// Delete references to previous pair
-		state.sorted_blocks[state.pair_idx * 2] = nullptr;
-		state.sorted_blocks[state.pair_idx * 2 + 1] = nullptr;
-		// Advance pair
-		state.pair_idx++;
-		state.l_start = 0;
-		state.r_start = 0;
+	D_ASSERT(left->Remaining() + right->Remaining() == state.block_capacity ||
+	         (l_end == left_block.Count() && r_end == right_block.Count()));
+	FinishPartition(l_end);
+}
+
+void MergeSorter::FinishPartition(idx_t l_end) {
+	lock_guard<mutex> pair_guard(state.lock);
+	auto &merge_path = state.merge_path_states[pair_idx];
+	merge_path.active_count--;
+	merge_path.sliced[partition_idx] = true;
+	merge_path.l_ends[partition_idx] = l_end;
+	merge_path.sliced_count++;
+	if (merge_path.sliced_count == merge_path.partition_count) {
+		// Delete references to the pair, the slices hold their own references
+		state.sorted_blocks[pair_idx * 2] = nullptr;
+		state.sorted_blocks[pair_idx * 2 + 1] = nullptr;
+		return;
+	}
+	// Advance the leading partitions that have been sliced
+	auto &left_block = *state.sorted_blocks[pair_idx * 2];
+	auto &right_block = *state.sorted_blocks[pair_idx * 2 + 1];
+	const idx_t total_count = left_block.Count() + right_block.Count();
+	while (merge_path.prefix_count < merge_path.partition_count && merge_path.sliced[merge_path.prefix_count]) {
+		merge_path.l_prefix = merge_path.l_ends[merge_path.prefix_count];
+		merge_path.prefix_count++;
+		merge_path.r_prefix =
+		    MinValue(merge_path.prefix_count * state.block_capacity, total_count) - merge_path.l_prefix;
+	}
+	if (merge_path.active_count == 0) {
+		// No other thread is reading the blocks of this pair: the blocks before the sliced partitions can be released
+		left_block.ReleaseBlocks(merge_path.l_prefix);
+		right_block.ReleaseBlocks(merge_path.r_prefix);
 	}
 }
 
 int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx) {
 	D_ASSERT(l_idx < l.sb->Count());
 	D_ASSERT(r_idx < r.sb->Count());
-
-	// Easy comparison using the previous result (intersections must increase monotonically)
-	if (l_idx < state.l_start) {
-		return -1;
-	}
-	if (r_idx < state.r_start) {
-		return 1;
-	}
+	// The blocks before the known boundary may have been released
+	D_ASSERT(l_idx >= l_lower && r_idx >= r_lower);
 
 	l.sb->GlobalToLocalIndex(l_idx, l.block_idx, l.entry_idx);
 	r.sb->GlobalToLocalIndex(r_idx, r.block_idx, r.entry_idx);
@@ -164,79 +191,27 @@ int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const i
 void MergeSorter::GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx) {
 	const idx_t l_count = left->sb->Count();
 	const idx_t r_count = right->sb->Count();
-	// Cover some edge cases
-	// Code coverage off because these edge cases cannot happen unless other code changes
-	// Edge cases have been tested extensively while developing Merge Path in a script
-	// LCOV_EXCL_START
+	D_ASSERT(diagonal >= l_lower + r_lower);
 	if (diagonal >= l_count + r_count) {
 		l_idx = l_count;
 		r_idx = r_count;
 		return;
-	} else if (diagonal == 0) {
-		l_idx = 0;
-		r_idx = 0;
-		return;
-	} else if (l_count == 0) {
-		l_idx = 0;
-		r_idx = diagonal;
-		return;
-	} else if (r_count == 0) {
-		r_idx = 0;
-		l_idx = diagonal;
-		return;
 	}
-	// LCOV_EXCL_STOP
-	// Determine offsets for the binary search
-	const idx_t l_offset = MinValue(l_count, diagonal);
-	const idx_t r_offset = diagonal > l_count ? diagonal - l_count : 0;
-	D_ASSERT(l_offset + r_offset == diagonal);
-	const idx_t search_space = diagonal > MaxValue(l_count, r_count) ? l_count + r_count - diagonal
-	                                                                 : MinValue(diagonal, MinValue(l_count, r_count));
-	// Double binary search
-	idx_t li = 0;
-	idx_t ri = search_space - 1;
-	idx_t middle;
-	int comp_res;
-	while (li <= ri) {
-		middle = (li + ri) / 2;
-		l_idx = l_offset - middle;
-		r_idx = r_offset + middle;
-		if (l_idx == l_count || r_idx == 0) {
-			comp_res = CompareUsingGlobalIndex(*left, *right, l_idx - 1, r_idx);
-			if (comp_res > 0) {
-				l_idx--;
-				r_idx++;
-			} else {
-				return;
-			}
-			if (l_idx == 0 || r_idx == r_count) {
-				// This case is incredibly difficult to cover as it is dependent on parallelism randomness
-				// But it has been tested extensively during development in a script
-				// LCOV_EXCL_START
-				return;
-				// LCOV_EXCL_STOP
-			} else {
-				break;
-			}
-		}
-		comp_res = CompareUsingGlobalIndex(*left, *right, l_idx, r_idx);
-		if (comp_res > 0) {
-			li = middle + 1;
+	// Binary search for the number of rows of the left block within the first 'diagonal' rows of the merge.
+	// Rows of the left block go first if they are equal, so that the boundary does not depend on the known boundary
+	// that bounds the search: the end of a partition is always the start of the next one.
+	idx_t lo = MaxValue(l_lower, diagonal > r_count ? diagonal - r_count : 0);
+	idx_t hi = MinValue(MinValue(diagonal, l_count), diagonal - r_lower);
+	while (lo < hi) {
+		const idx_t middle = lo + (hi - lo + 1) / 2;
+		if (CompareUsingGlobalIndex(*left, *right, middle - 1, diagonal - middle) <= 0) {
+			lo = middle;
 		} else {
-			ri = middle - 1;
+			hi = middle - 1;
 		}
 	}
-	int l_r_min1 = CompareUsingGlobalIndex(*left, *right, l_idx, r_idx - 1);
-	int l_min1_r = CompareUsingGlobalIndex(*left, *right, l_idx - 1, r_idx);
-	if (l_r_min1 > 0 && l_min1_r < 0) {
-		return;
-	} else if (l_r_min1 > 0) {
-		l_idx--;
-		r_idx++;
-	} else if (l_min1_r < 0) {
-		l_idx++;
-		r_idx--;
-	}
+	l_idx = lo;
+	r_idx = diagonal - lo;
 }
 
 void MergeSorter::ComputeMerge(const idx_t &count, bool left_smaller[]) {
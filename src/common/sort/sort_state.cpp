@@ -437,11 +437,17 @@ void GlobalSortState::InitializeMergeRound() {
 	// Init merge path path indices
 	pair_idx = 0;
 	num_pairs = sorted_blocks.size() / 2;
-	l_start = 0;
-	r_start = 0;
-	// Allocate room for merge results
+	partition_idx = 0;
+	merge_path_states.clear();
+	merge_path_states.resize(num_pairs);
+	// Allocate room for merge results, each partition produces one block
 	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
-		sorted_blocks_temp.emplace_back();
+		auto &merge_path = merge_path_states[p_idx];
+		const idx_t count = sorted_blocks[p_idx * 2]->Count() + sorted_blocks[p_idx * 2 + 1]->Count();
+		merge_path.partition_count = MaxValue<idx_t>((count + block_capacity - 1) / block_capacity, 1);
+		merge_path.sliced.resize(merge_path.partition_count, false);
+		merge_path.l_ends.resize(merge_path.partition_count, 0);
+		sorted_blocks_temp.emplace_back(merge_path.partition_count);
 	}
 }
 
@@ -40,7 +40,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), skip_lookups(false), capacity(0),
+      aggregate_allocator(make_shared<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -139,6 +140,10 @@ idx_t GroupedAggregateHashTable::ApplyBitMask(hash_t hash) const {
 
 void GroupedAggregateHashTable::Verify() {
 #ifdef DEBUG
+	if (skip_lookups) {
+		// The groups are not in the pointer table
+		return;
+	}
 	idx_t total_count = 0;
 	for (idx_t i = 0; i < capacity; i++) {
 		const auto &entry = entries[i];
@@ -165,6 +170,16 @@ void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
 
+bool GroupedAggregateHashTable::SkipLookups() const {
+	return skip_lookups;
+}
+
+void GroupedAggregateHashTable::SetSkipLookups(bool skip_lookups_p) {
+	// The pointer table must not point to any groups when switching, as they would not all be in it
+	D_ASSERT(Count() == 0);
+	skip_lookups = skip_lookups_p;
+}
+
 void GroupedAggregateHashTable::Resize(idx_t size) {
 	D_ASSERT(size >= STANDARD_VECTOR_SIZE);
 	D_ASSERT(IsPowerOfTwo(size));
@@ -312,6 +327,11 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(addresses_v.GetType() == LogicalType::POINTER);
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
+	if (skip_lookups) {
+		// Every row becomes a new group, which are combined with the other groups in the same partition later on
+		return CreateGroupsWithoutLookup(groups, group_hashes_v, addresses_v, new_groups_out);
+	}
+
 	// Need to fit the entire vector, and resize at threshold
 	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
 		Verify();
@@ -436,6 +456,39 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	return new_group_count;
 }
 
+idx_t GroupedAggregateHashTable::CreateGroupsWithoutLookup(DataChunk &groups, Vector &group_hashes_v,
+                                                           Vector &addresses_v, SelectionVector &new_groups_out) {
+	const auto group_count = groups.size();
+	if (state.group_chunk.ColumnCount() == 0) {
+		state.group_chunk.InitializeEmpty(layout.GetTypes());
+	}
+	for (idx_t grp_idx = 0; grp_idx < groups.ColumnCount(); grp_idx++) {
+		state.group_chunk.data[grp_idx].Reference(groups.data[grp_idx]);
+	}
+	state.group_chunk.data[groups.ColumnCount()].Reference(group_hashes_v);
+	state.group_chunk.SetCardinality(groups);
+
+	// Append all rows, and initialize their aggregate states
+	auto &chunk_state = state.append_state.chunk_state;
+	TupleDataCollection::ToUnifiedFormat(chunk_state, state.group_chunk);
+	const auto &sel = *FlatVector::IncrementalSelectionVector();
+	partitioned_data->AppendUnified(state.append_state, state.group_chunk, sel, group_count);
+	RowOperations::InitializeStates(layout, chunk_state.row_locations, sel, group_count);
+
+	// The rows are scattered over the partitions, so we have to map them back to their input row
+	addresses_v.Flatten(group_count);
+	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
+	const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+	const auto &row_sel = state.append_state.reverse_partition_sel;
+	for (idx_t i = 0; i < group_count; i++) {
+		addresses[i] = row_locations[row_sel.get_index(i)];
+		new_groups_out.set_index(i, i);
+	}
+
+	count += group_count;
+	return group_count;
+}
+
 // this is to support distinct aggregations where we need to record whether we
 // have already seen a value for a group
 idx_t GroupedAggregateHashTable::FindOrCreateGroups(DataChunk &groups, Vector &group_hashes, Vector &addresses_out,
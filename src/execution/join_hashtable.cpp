@@ -18,7 +18,7 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
                              vector<LogicalType> btypes, JoinType type_p)
     : buffer_manager(buffer_manager_p), conditions(conditions_p), build_types(std::move(btypes)), entry_size(0),
       tuple_size(0), vfound(Value::BOOLEAN(false)), join_type(type_p), finalized(false), has_null(false),
-      external(false), radix_bits(4), partition_start(0), partition_end(0) {
+      hash_shift(0), external(false), radix_bits(4), partition_start(0), partition_end(0) {
 
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -86,32 +86,44 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, idx_t count) {
-	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		D_ASSERT(!ConstantVector::IsNull(hashes));
-		auto indices = ConstantVector::GetData<hash_t>(hashes);
-		*indices = *indices & bitmask;
-	} else {
-		hashes.Flatten(count);
-		auto indices = FlatVector::GetData<hash_t>(hashes);
-		for (idx_t i = 0; i < count; i++) {
-			indices[i] &= bitmask;
-		}
-	}
+static inline void PrefetchAddress(const void *address) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address);
+#endif
 }
 
-void JoinHashTable::ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
+void JoinHashTable::GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers) {
 	UnifiedVectorFormat hdata;
 	hashes.ToUnifiedFormat(count, hdata);
 
 	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
-	auto result_data = FlatVector::GetData<data_ptr_t *>(pointers);
-	auto main_ht = reinterpret_cast<data_ptr_t *>(hash_map.get());
+	auto result_data = FlatVector::GetData<data_ptr_t>(pointers);
+	auto entries = reinterpret_cast<const aggr_ht_entry_t *>(hash_map.get());
+
+	// prefetch the entries of all keys first, so that their cache misses overlap
+	for (idx_t i = 0; i < count; i++) {
+		auto hindex = hdata.sel->get_index(sel.get_index(i));
+		PrefetchAddress(entries + ((hash_data[hindex] >> hash_shift) & bitmask));
+	}
+
 	for (idx_t i = 0; i < count; i++) {
 		auto rindex = sel.get_index(i);
 		auto hindex = hdata.sel->get_index(rindex);
 		auto hash = hash_data[hindex];
-		result_data[rindex] = main_ht + (hash & bitmask);
+		auto salt = aggr_ht_entry_t::ExtractSalt(hash);
+
+		// linear probing: the rows with the same salt are chained from the first entry with that salt
+		result_data[rindex] = nullptr;
+		for (auto ht_offset = (hash >> hash_shift) & bitmask; entries[ht_offset].IsOccupied();
+		     ht_offset = (ht_offset + 1) & bitmask) {
+			auto &entry = entries[ht_offset];
+			if (entry.GetSalt() == salt) {
+				result_data[rindex] = entry.GetPointer();
+				// prefetch the row, its keys are compared next
+				PrefetchAddress(result_data[rindex]);
+				break;
+			}
+		}
 	}
 }
 
@@ -244,22 +256,32 @@ idx_t JoinHashTable::PrepareKeys(DataChunk &keys, vector<TupleDataVectorFormat>
 }
 
 template <bool PARALLEL>
-static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t indices[], const idx_t count,
-                                    const data_ptr_t key_locations[], const idx_t pointer_offset) {
+static inline void InsertHashesLoop(atomic<aggr_ht_entry_t> entries[], const hash_t hashes[], const idx_t count,
+                                    const data_ptr_t key_locations[], const idx_t pointer_offset,
+                                    const idx_t hash_shift, const uint64_t bitmask) {
 	for (idx_t i = 0; i < count; i++) {
-		const auto index = indices[i];
-		if (PARALLEL) {
-			data_ptr_t head;
-			do {
-				head = pointers[index];
-				Store<data_ptr_t>(head, key_locations[i] + pointer_offset);
-			} while (!std::atomic_compare_exchange_weak(&pointers[index], &head, key_locations[i]));
-		} else {
+		const auto salt = aggr_ht_entry_t::ExtractSalt(hashes[i]);
+		auto ht_offset = (hashes[i] >> hash_shift) & bitmask;
+		while (true) {
+			auto entry = entries[ht_offset].load();
+			if (entry.IsOccupied() && entry.GetSalt() != salt) {
+				// occupied by rows with a different salt: linear probing
+				ht_offset = (ht_offset + 1) & bitmask;
+				continue;
+			}
+			// the entry is empty, or it holds the chain of this salt: the row becomes the new head of the chain
 			// set prev in current key to the value (NOTE: this will be nullptr if there is none)
-			Store<data_ptr_t>(pointers[index], key_locations[i] + pointer_offset);
-
-			// set pointer to current tuple
-			pointers[index] = key_locations[i];
+			Store<data_ptr_t>(entry.IsOccupied() ? entry.GetPointer() : nullptr, key_locations[i] + pointer_offset);
+			aggr_ht_entry_t new_entry(salt);
+			new_entry.SetPointer(key_locations[i]);
+			if (!PARALLEL) {
+				entries[ht_offset] = new_entry;
+				break;
+			}
+			if (std::atomic_compare_exchange_weak(&entries[ht_offset], &entry, new_entry)) {
+				break;
+			}
+			// another thread modified the entry in the meantime: look at it again
 		}
 	}
 }
@@ -267,19 +289,16 @@ static inline void InsertHashesLoop(atomic<data_ptr_t> pointers[], const hash_t
 void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
 
-	// use bitmask to get position in array
-	ApplyBitmask(hashes, count);
-
 	hashes.Flatten(count);
 	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
 
-	auto pointers = reinterpret_cast<atomic<data_ptr_t> *>(hash_map.get());
-	auto indices = FlatVector::GetData<hash_t>(hashes);
+	auto entries = reinterpret_cast<atomic<aggr_ht_entry_t> *>(hash_map.get());
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
 
 	if (parallel) {
-		InsertHashesLoop<true>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<true>(entries, hash_data, count, key_locations, pointer_offset, hash_shift, bitmask);
 	} else {
-		InsertHashesLoop<false>(pointers, indices, count, key_locations, pointer_offset);
+		InsertHashesLoop<false>(entries, hash_data, count, key_locations, pointer_offset, hash_shift, bitmask);
 	}
 }
 
@@ -289,24 +308,35 @@ void JoinHashTable::InitializePointerTable() {
 
 	if (hash_map.get()) {
 		// There is already a hash map
-		auto current_capacity = hash_map.GetSize() / sizeof(data_ptr_t);
+		auto current_capacity = hash_map.GetSize() / sizeof(aggr_ht_entry_t);
 		if (capacity > current_capacity) {
 			// Need more space
-			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(aggr_ht_entry_t));
 		} else {
 			// Just use the current hash map
 			capacity = current_capacity;
 		}
 	} else {
 		// Allocate a hash map
-		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(data_ptr_t));
+		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(aggr_ht_entry_t));
 	}
-	D_ASSERT(hash_map.GetSize() == capacity * sizeof(data_ptr_t));
+	D_ASSERT(hash_map.GetSize() == capacity * sizeof(aggr_ht_entry_t));
 
 	// initialize HT with all-zero entries
-	std::fill_n(reinterpret_cast<data_ptr_t *>(hash_map.get()), capacity, nullptr);
+	std::fill_n(reinterpret_cast<aggr_ht_entry_t *>(hash_map.get()), capacity, aggr_ht_entry_t(0));
 
 	bitmask = capacity - 1;
+
+	// The position in the pointer table is taken from the bits right below the salt, which start with the radix bits.
+	// Every radix partition then maps to its own contiguous range of the pointer table: a finalize task that inserts
+	// the rows of a single partition only touches that range, which keeps the writes local even for very large
+	// builds. Within an external round, the partitions share their radix bits, so we use the lower bits instead.
+	const auto capacity_bits = RadixPartitioning::RadixBits(capacity);
+	if (!external && capacity_bits <= RadixPartitioning::Shift(0)) {
+		hash_shift = RadixPartitioning::Shift(capacity_bits);
+	} else {
+		hash_shift = 0;
+	}
 }
 
 void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
@@ -356,14 +386,14 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 	}
 
 	if (precomputed_hashes) {
-		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
 	} else {
 		// hash all the keys
 		Vector hashes(LogicalType::HASH);
 		Hash(keys, *current_sel, ss->count, hashes);
 
 		// now initialize the pointers of the scan structure based on the hashes
-		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+		GetRowPointers(hashes, *current_sel, ss->count, ss->pointers);
 	}
 
 	// create the selection vector linking to only non-empty entries
@@ -462,7 +492,6 @@ void ScanStructure::InitializeSelectionVector(const SelectionVector *&current_se
 	auto cnt = count;
 	for (idx_t i = 0; i < cnt; i++) {
 		const auto idx = current_sel->get_index(i);
-		ptrs[idx] = Load<data_ptr_t>(ptrs[idx]);
 		if (ptrs[idx]) {
 			sel_vector.set_index(non_empty_count++, idx);
 		}
@@ -874,8 +903,10 @@ bool JoinHashTable::RequiresExternalJoin(ClientConfig &config, vector<unique_ptr
 }
 
 void JoinHashTable::Unpartition() {
+	partition_chunk_ends.clear();
 	for (auto &partition : sink_collection->GetPartitions()) {
 		data_collection->Combine(*partition);
+		partition_chunk_ends.push_back(data_collection->ChunkCount());
 	}
 }
 
@@ -1037,7 +1068,7 @@ unique_ptr<ScanStructure> JoinHashTable::ProbeAndSpill(DataChunk &keys, TupleDat
 	}
 
 	// now initialize the pointers of the scan structure based on the hashes
-	ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+	GetRowPointers(hashes, *current_sel, ss->count, ss->pointers);
 
 	// create the selection vector linking to only non-empty entries
 	ss->InitializeSelectionVector(current_sel);
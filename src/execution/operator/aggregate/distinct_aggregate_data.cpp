@@ -78,6 +78,7 @@ DistinctAggregateData::DistinctAggregateData(const DistinctAggregateCollectionIn
 	grouped_aggregate_data.resize(info.table_count);
 	radix_tables.resize(info.table_count);
 	grouping_sets.resize(info.table_count);
+	table_input_types.resize(info.table_count);
 
 	for (auto &i : info.indices) {
 		auto &aggregate = info.aggregates[i]->Cast<BoundAggregateExpression>();
@@ -102,6 +103,24 @@ DistinctAggregateData::DistinctAggregateData(const DistinctAggregateCollectionIn
 		// Create the hashtable for the aggregate
 		grouped_aggregate_data[table_idx] = make_uniq<GroupedAggregateData>();
 		grouped_aggregate_data[table_idx]->InitializeDistinct(info.aggregates[i], group_expressions);
+		if (info.IsTagged(table_idx)) {
+			// The table is shared by aggregates with different inputs: these are added to the table in the layout of
+			// this aggregate, followed by a tag that tells them apart
+			auto &data = *grouped_aggregate_data[table_idx];
+			idx_t tag_index = 0;
+			for (auto &group : data.groups) {
+				tag_index = MaxValue<idx_t>(tag_index, group->Cast<BoundReferenceExpression>().index + 1);
+			}
+			auto &input_types = table_input_types[table_idx];
+			input_types.resize(tag_index + 1, LogicalType::SQLNULL);
+			for (idx_t group_idx = 0; group_idx < data.groups.size(); group_idx++) {
+				auto &group = data.groups[group_idx]->Cast<BoundReferenceExpression>();
+				input_types[group.index] = data.group_types[group_idx];
+			}
+			input_types[tag_index] = LogicalType::UTINYINT;
+			data.InitializeDistinctTag(tag_index);
+			grouping_set.insert(group_by_size + aggregate.children.size());
+		}
 		radix_tables[table_idx] =
 		    make_uniq<RadixPartitionedHashTable>(grouping_set, *grouped_aggregate_data[table_idx]);
 
@@ -139,25 +158,56 @@ struct FindMatchingAggregate {
 	const aggr_ref_t aggr_r;
 };
 
+static bool HaveSameInputTypes(const BoundAggregateExpression &aggr, const BoundAggregateExpression &other) {
+	if (aggr.children.size() != other.children.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < aggr.children.size(); i++) {
+		if (aggr.children[i]->return_type != other.children[i]->return_type) {
+			return false;
+		}
+	}
+	return true;
+}
+
 idx_t DistinctAggregateCollectionInfo::CreateTableIndexMap() {
-	vector<aggr_ref_t> table_inputs;
+	//! The different inputs, and the table and tag they are assigned to
+	vector<aggr_ref_t> inputs;
+	vector<idx_t> input_tables;
+	vector<idx_t> input_tags;
 
 	D_ASSERT(table_map.empty());
 	for (auto &agg_idx : indices) {
 		D_ASSERT(agg_idx < aggregates.size());
 		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
 
-		auto matching_inputs =
-		    std::find_if(table_inputs.begin(), table_inputs.end(), FindMatchingAggregate(std::ref(aggregate)));
-		if (matching_inputs != table_inputs.end()) {
-			//! Assign the existing table to the aggregate
-			idx_t found_idx = std::distance(table_inputs.begin(), matching_inputs);
-			table_map[agg_idx] = found_idx;
+		auto matching_inputs = std::find_if(inputs.begin(), inputs.end(), FindMatchingAggregate(std::ref(aggregate)));
+		if (matching_inputs != inputs.end()) {
+			//! Assign the table (and tag) of the identical input to the aggregate
+			idx_t found_idx = std::distance(inputs.begin(), matching_inputs);
+			table_map[agg_idx] = input_tables[found_idx];
+			tag_map[agg_idx] = input_tags[found_idx];
 			continue;
 		}
-		//! Create a new table and assign its index to the aggregate
-		table_map[agg_idx] = table_inputs.size();
-		table_inputs.push_back(std::ref(aggregate));
+		//! Add the input to a table with inputs of the same types, so all of them share one hash table
+		idx_t table_idx;
+		for (table_idx = 0; table_idx < table_inputs.size(); table_idx++) {
+			auto &table_aggregate = aggregates[table_inputs[table_idx][0]]->Cast<BoundAggregateExpression>();
+			if (table_inputs[table_idx].size() < MAX_TABLE_INPUTS && HaveSameInputTypes(aggregate, table_aggregate)) {
+				break;
+			}
+		}
+		if (table_idx == table_inputs.size()) {
+			//! Create a new table
+			table_inputs.emplace_back();
+		}
+		table_map[agg_idx] = table_idx;
+		tag_map[agg_idx] = table_inputs[table_idx].size();
+		table_inputs[table_idx].push_back(agg_idx);
+
+		inputs.push_back(std::ref(aggregate));
+		input_tables.push_back(table_idx);
+		input_tags.push_back(tag_map[agg_idx]);
 	}
 	//! Every distinct aggregate needs to be assigned an index
 	D_ASSERT(table_map.size() == indices.size());
@@ -171,6 +221,11 @@ bool DistinctAggregateCollectionInfo::AnyDistinct() const {
 	return !indices.empty();
 }
 
+bool DistinctAggregateCollectionInfo::IsTagged(idx_t table_idx) const {
+	D_ASSERT(table_idx < table_inputs.size());
+	return table_inputs[table_idx].size() > 1;
+}
+
 const unsafe_vector<idx_t> &DistinctAggregateCollectionInfo::Indices() const {
 	return this->indices;
 }
@@ -213,4 +268,27 @@ bool DistinctAggregateData::IsDistinct(idx_t index) const {
 	return is_distinct;
 }
 
+void DistinctAggregateData::PopulateTableInput(idx_t aggr_idx, DataChunk &input, DataChunk &table_input) const {
+	auto table_idx = info.table_map.at(aggr_idx);
+	D_ASSERT(info.IsTagged(table_idx));
+	auto &aggregate = info.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+	auto &table_groups = grouped_aggregate_data[table_idx]->groups;
+	// The groups of the table are followed by the children of the aggregate that created the table, and the tag
+	const auto child_offset = table_groups.size() - aggregate.children.size() - 1;
+
+	table_input.InitializeEmpty(table_input_types[table_idx]);
+	for (idx_t group_idx = 0; group_idx < child_offset; group_idx++) {
+		auto index = table_groups[group_idx]->Cast<BoundReferenceExpression>().index;
+		table_input.data[index].Reference(input.data[index]);
+	}
+	for (idx_t child_idx = 0; child_idx < aggregate.children.size(); child_idx++) {
+		auto &table_child = table_groups[child_offset + child_idx]->Cast<BoundReferenceExpression>();
+		auto &child = aggregate.children[child_idx]->Cast<BoundReferenceExpression>();
+		table_input.data[table_child.index].Reference(input.data[child.index]);
+	}
+	auto &tag = table_groups.back()->Cast<BoundReferenceExpression>();
+	table_input.data[tag.index].Reference(Value::UTINYINT(static_cast<uint8_t>(info.tag_map.at(aggr_idx))));
+	table_input.SetCardinality(input);
+}
+
 } // namespace duckdb
@@ -1,4 +1,5 @@
 #include "duckdb/execution/operator/aggregate/grouped_aggregate_data.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 
 namespace duckdb {
 
@@ -68,6 +69,11 @@ void GroupedAggregateData::InitializeDistinct(const unique_ptr<Expression> &aggr
 	}
 }
 
+void GroupedAggregateData::InitializeDistinctTag(idx_t tag_index) {
+	group_types.push_back(LogicalType::UTINYINT);
+	groups.push_back(make_uniq<BoundReferenceExpression>(LogicalType::UTINYINT, tag_index));
+}
+
 void GroupedAggregateData::InitializeDistinctGroups(const vector<unique_ptr<Expression>> *groups_p) {
 	if (!groups_p) {
 		return;
@@ -46,22 +46,12 @@ HashAggregateGroupingLocalState::HashAggregateGroupingLocalState(const PhysicalH
 		return;
 	}
 	auto &distinct_data = *data.distinct_data;
+	D_ASSERT(!op.distinct_collection_info->Indices().empty());
 
-	auto &distinct_indices = op.distinct_collection_info->Indices();
-	D_ASSERT(!distinct_indices.empty());
-
-	distinct_states.resize(op.distinct_collection_info->aggregates.size());
-	auto &table_map = op.distinct_collection_info->table_map;
-
-	for (auto &idx : distinct_indices) {
-		idx_t table_idx = table_map[idx];
-		auto &radix_table = distinct_data.radix_tables[table_idx];
-		if (radix_table == nullptr) {
-			// This aggregate has identical input as another aggregate, so no table is created for it
-			continue;
-		}
-		// Initialize the states of the radix tables used for the distinct aggregates
-		distinct_states[table_idx] = radix_table->GetLocalSinkState(context);
+	// Initialize the states of the radix tables used for the distinct aggregates
+	distinct_states.resize(distinct_data.radix_tables.size());
+	for (idx_t table_idx = 0; table_idx < distinct_data.radix_tables.size(); table_idx++) {
+		distinct_states[table_idx] = distinct_data.radix_tables[table_idx]->GetLocalSinkState(context);
 	}
 }
 
@@ -271,15 +261,7 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 	// Create an empty filter for Sink, since we don't need to update any aggregate states here
 	unsafe_vector<idx_t> empty_filter;
 
-	for (idx_t &idx : distinct_info.indices) {
-		auto &aggregate = grouped_aggregate_data.aggregates[idx]->Cast<BoundAggregateExpression>();
-
-		D_ASSERT(distinct_info.table_map.count(idx));
-		idx_t table_idx = distinct_info.table_map[idx];
-		if (!distinct_data->radix_tables[table_idx]) {
-			continue;
-		}
-		D_ASSERT(distinct_data->radix_tables[table_idx]);
+	for (idx_t table_idx = 0; table_idx < distinct_data->radix_tables.size(); table_idx++) {
 		auto &radix_table = *distinct_data->radix_tables[table_idx];
 		auto &radix_global_sink = *distinct_state->radix_states[table_idx];
 		auto &radix_local_sink = *grouping_lstate.distinct_states[table_idx];
@@ -287,50 +269,61 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 		InterruptState interrupt_state;
 		OperatorSinkInput sink_input {radix_global_sink, radix_local_sink, interrupt_state};
 
-		if (aggregate.filter) {
-			DataChunk filter_chunk;
-			auto &filtered_data = sink.filter_set.GetFilterData(idx);
-			filter_chunk.InitializeEmpty(filtered_data.filtered_payload.GetTypes());
-
-			// Add the filter Vector (BOOL)
-			auto it = filter_indexes.find(aggregate.filter.get());
-			D_ASSERT(it != filter_indexes.end());
-			D_ASSERT(it->second < chunk.data.size());
-			auto &filter_bound_ref = aggregate.filter->Cast<BoundReferenceExpression>();
-			filter_chunk.data[filter_bound_ref.index].Reference(chunk.data[it->second]);
-			filter_chunk.SetCardinality(chunk.size());
+		// Add the different inputs of the aggregates that share this table
+		for (auto &idx : distinct_info.table_inputs[table_idx]) {
+			auto &aggregate = grouped_aggregate_data.aggregates[idx]->Cast<BoundAggregateExpression>();
 
-			// We cant use the AggregateFilterData::ApplyFilter method, because the chunk we need to
-			// apply the filter to also has the groups, and the filtered_data.filtered_payload does not have those.
-			SelectionVector sel_vec(STANDARD_VECTOR_SIZE);
-			idx_t count = filtered_data.filter_executor.SelectExpression(filter_chunk, sel_vec);
-
-			if (count == 0) {
-				continue;
-			}
-
-			// Because the 'input' chunk needs to be re-used after this, we need to create
-			// a duplicate of it, that we can apply the filter to
+			reference<DataChunk> aggregate_input(chunk);
 			DataChunk filtered_input;
-			filtered_input.InitializeEmpty(chunk.GetTypes());
-
-			for (idx_t group_idx = 0; group_idx < grouped_aggregate_data.groups.size(); group_idx++) {
-				auto &group = grouped_aggregate_data.groups[group_idx];
-				auto &bound_ref = group->Cast<BoundReferenceExpression>();
-				filtered_input.data[bound_ref.index].Reference(chunk.data[bound_ref.index]);
+			if (aggregate.filter) {
+				DataChunk filter_chunk;
+				auto &filtered_data = sink.filter_set.GetFilterData(idx);
+				filter_chunk.InitializeEmpty(filtered_data.filtered_payload.GetTypes());
+
+				// Add the filter Vector (BOOL)
+				auto it = filter_indexes.find(aggregate.filter.get());
+				D_ASSERT(it != filter_indexes.end());
+				D_ASSERT(it->second < chunk.data.size());
+				auto &filter_bound_ref = aggregate.filter->Cast<BoundReferenceExpression>();
+				filter_chunk.data[filter_bound_ref.index].Reference(chunk.data[it->second]);
+				filter_chunk.SetCardinality(chunk.size());
+
+				// We cant use the AggregateFilterData::ApplyFilter method, because the chunk we need to
+				// apply the filter to also has the groups, and the filtered_data.filtered_payload does not have those.
+				SelectionVector sel_vec(STANDARD_VECTOR_SIZE);
+				idx_t count = filtered_data.filter_executor.SelectExpression(filter_chunk, sel_vec);
+
+				if (count == 0) {
+					continue;
+				}
+
+				// Because the 'input' chunk needs to be re-used after this, we need to create
+				// a duplicate of it, that we can apply the filter to
+				filtered_input.InitializeEmpty(chunk.GetTypes());
+
+				for (idx_t group_idx = 0; group_idx < grouped_aggregate_data.groups.size(); group_idx++) {
+					auto &group = grouped_aggregate_data.groups[group_idx];
+					auto &bound_ref = group->Cast<BoundReferenceExpression>();
+					filtered_input.data[bound_ref.index].Reference(chunk.data[bound_ref.index]);
+				}
+				for (idx_t child_idx = 0; child_idx < aggregate.children.size(); child_idx++) {
+					auto &child = aggregate.children[child_idx];
+					auto &bound_ref = child->Cast<BoundReferenceExpression>();
+
+					filtered_input.data[bound_ref.index].Reference(chunk.data[bound_ref.index]);
+				}
+				filtered_input.Slice(sel_vec, count);
+				filtered_input.SetCardinality(count);
+				aggregate_input = filtered_input;
 			}
-			for (idx_t child_idx = 0; child_idx < aggregate.children.size(); child_idx++) {
-				auto &child = aggregate.children[child_idx];
-				auto &bound_ref = child->Cast<BoundReferenceExpression>();
 
-				filtered_input.data[bound_ref.index].Reference(chunk.data[bound_ref.index]);
+			if (distinct_info.IsTagged(table_idx)) {
+				DataChunk table_input;
+				distinct_data->PopulateTableInput(idx, aggregate_input.get(), table_input);
+				radix_table.Sink(context, table_input, sink_input, empty_chunk, empty_filter);
+			} else {
+				radix_table.Sink(context, aggregate_input.get(), sink_input, empty_chunk, empty_filter);
 			}
-			filtered_input.Slice(sel_vec, count);
-			filtered_input.SetCardinality(count);
-
-			radix_table.Sink(context, filtered_input, sink_input, empty_chunk, empty_filter);
-		} else {
-			radix_table.Sink(context, chunk, sink_input, empty_chunk, empty_filter);
 		}
 	}
 }
@@ -418,9 +411,6 @@ void PhysicalHashAggregate::CombineDistinct(ExecutionContext &context, OperatorS
 
 		const auto table_count = distinct_data->radix_tables.size();
 		for (idx_t table_idx = 0; table_idx < table_count; table_idx++) {
-			if (!distinct_data->radix_tables[table_idx]) {
-				continue;
-			}
 			auto &radix_table = *distinct_data->radix_tables[table_idx];
 			auto &radix_global_sink = *distinct_state->radix_states[table_idx];
 			auto &radix_local_sink = *grouping_lstate.distinct_states[table_idx];
@@ -567,29 +557,17 @@ void HashAggregateDistinctFinalizeEvent::Schedule() {
 }
 
 void HashAggregateDistinctFinalizeEvent::CreateGlobalSources() {
-	auto &aggregates = op.grouped_aggregate_data.aggregates;
 	global_source_states.reserve(op.groupings.size());
 	for (idx_t grouping_idx = 0; grouping_idx < op.groupings.size(); grouping_idx++) {
 		auto &grouping = op.groupings[grouping_idx];
 		auto &distinct_data = *grouping.distinct_data;
 
-		vector<unique_ptr<GlobalSourceState>> aggregate_sources;
-		aggregate_sources.reserve(aggregates.size());
-		for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
-			auto &aggregate = aggregates[agg_idx];
-			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
-
-			if (!aggr.IsDistinct()) {
-				aggregate_sources.push_back(nullptr);
-				continue;
-			}
-			D_ASSERT(distinct_data.info.table_map.count(agg_idx));
-
-			auto table_idx = distinct_data.info.table_map.at(agg_idx);
-			auto &radix_table_p = distinct_data.radix_tables[table_idx];
-			aggregate_sources.push_back(radix_table_p->GetGlobalSourceState(context));
+		vector<unique_ptr<GlobalSourceState>> table_sources;
+		table_sources.reserve(distinct_data.radix_tables.size());
+		for (auto &radix_table : distinct_data.radix_tables) {
+			table_sources.push_back(radix_table->GetGlobalSourceState(context));
 		}
-		global_source_states.push_back(std::move(aggregate_sources));
+		global_source_states.push_back(std::move(table_sources));
 	}
 }
 
@@ -645,38 +623,41 @@ void HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping(const idx_t gr
 
 	auto &finalize_event = event->Cast<HashAggregateDistinctFinalizeEvent>();
 
-	idx_t payload_idx;
-	idx_t next_payload_idx = 0;
+	// For every table and every input (tag) of the table, the distinct aggregates with that input
+	vector<vector<vector<idx_t>>> table_aggregates(distinct_data.radix_tables.size());
+	for (idx_t table_idx = 0; table_idx < table_aggregates.size(); table_idx++) {
+		table_aggregates[table_idx].resize(info.table_inputs[table_idx].size());
+	}
+	vector<idx_t> payload_indices;
+	idx_t payload_idx = 0;
 	for (idx_t agg_idx = 0; agg_idx < op.grouped_aggregate_data.aggregates.size(); agg_idx++) {
-		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
-
-		// Forward the payload idx
-		payload_idx = next_payload_idx;
-		next_payload_idx = payload_idx + aggregate.children.size();
-
-		// If aggregate is not distinct, skip it
-		if (!distinct_data.IsDistinct(agg_idx)) {
-			continue;
+		payload_indices.push_back(payload_idx);
+		payload_idx += aggregates[agg_idx]->Cast<BoundAggregateExpression>().children.size();
+		if (distinct_data.IsDistinct(agg_idx)) {
+			auto table_idx = info.table_map.at(agg_idx);
+			table_aggregates[table_idx][info.tag_map.at(agg_idx)].push_back(agg_idx);
 		}
+	}
 
-		D_ASSERT(distinct_data.info.table_map.count(agg_idx));
-		const auto &table_idx = distinct_data.info.table_map.at(agg_idx);
+	SelectionVector tag_sel(STANDARD_VECTOR_SIZE);
+	for (idx_t table_idx = 0; table_idx < distinct_data.radix_tables.size(); table_idx++) {
 		auto &radix_table = distinct_data.radix_tables[table_idx];
 
 		auto &sink = *distinct_state.radix_states[table_idx];
 		auto local_source = radix_table->GetLocalSourceState(execution_context);
-		OperatorSourceInput source_input {*finalize_event.global_source_states[grouping_idx][agg_idx], *local_source,
-		                                  interrupt_state};
+		OperatorSourceInput source_input {*finalize_event.global_source_states[grouping_idx][table_idx],
+		                                  *local_source, interrupt_state};
 
 		// Create a duplicate of the output_chunk, because of multi-threading we cant alter the original
 		DataChunk output_chunk;
 		output_chunk.Initialize(executor.context, distinct_state.distinct_output_chunks[table_idx]->GetTypes());
 
+		auto &grouped_aggregate_data = *distinct_data.grouped_aggregate_data[table_idx];
+		const auto tagged = info.IsTagged(table_idx);
+
 		// Fetch all the data from the aggregate ht, and Sink it into the main ht
 		while (true) {
 			output_chunk.Reset();
-			group_chunk.Reset();
-			aggregate_input_chunk.Reset();
 
 			auto res = radix_table->GetData(execution_context, output_chunk, sink, source_input);
 			if (res == SourceResultType::FINISHED) {
@@ -687,22 +668,45 @@ void HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping(const idx_t gr
 				    "Unexpected interrupt from radix table GetData in HashAggregateDistinctFinalizeTask");
 			}
 
-			auto &grouped_aggregate_data = *distinct_data.grouped_aggregate_data[table_idx];
-			for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
-				auto &group = grouped_aggregate_data.groups[group_idx];
-				auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
-				group_chunk.data[bound_ref_expr.index].Reference(output_chunk.data[group_idx]);
-			}
-			group_chunk.SetCardinality(output_chunk);
-
-			for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size; child_idx++) {
-				aggregate_input_chunk.data[payload_idx + child_idx].Reference(
-				    output_chunk.data[group_by_size + child_idx]);
+			for (idx_t tag = 0; tag < table_aggregates[table_idx].size(); tag++) {
+				auto &tag_aggregates = table_aggregates[table_idx][tag];
+				group_chunk.Reset();
+				aggregate_input_chunk.Reset();
+
+				for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
+					auto &group = grouped_aggregate_data.groups[group_idx];
+					auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
+					group_chunk.data[bound_ref_expr.index].Reference(output_chunk.data[group_idx]);
+				}
+				group_chunk.SetCardinality(output_chunk);
+
+				// All aggregates with this input are updated at once
+				for (auto &agg_idx : tag_aggregates) {
+					auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
+					for (idx_t child_idx = 0; child_idx < aggregate.children.size(); child_idx++) {
+						aggregate_input_chunk.data[payload_indices[agg_idx] + child_idx].Reference(
+						    output_chunk.data[group_by_size + child_idx]);
+					}
+				}
+				aggregate_input_chunk.SetCardinality(output_chunk);
+
+				if (tagged) {
+					// Only the rows with the tag of this input belong to the aggregates
+					Vector tag_vector(Value::UTINYINT(static_cast<uint8_t>(tag)));
+					auto count = VectorOperations::Equals(output_chunk.data[grouped_aggregate_data.GroupCount() - 1],
+					                                      tag_vector, nullptr, output_chunk.size(), &tag_sel, nullptr);
+					if (count == 0) {
+						continue;
+					}
+					group_chunk.Slice(tag_sel, count);
+					aggregate_input_chunk.Slice(tag_sel, count);
+				}
+
+				// Sink it into the main ht
+				unsafe_vector<idx_t> filter(tag_aggregates.begin(), tag_aggregates.end());
+				grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk,
+				                              filter);
 			}
-			aggregate_input_chunk.SetCardinality(output_chunk);
-
-			// Sink it into the main ht
-			grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk, {agg_idx});
 		}
 	}
 	grouping_data.table_data.Combine(execution_context, global_sink_state, *local_sink_state);
@@ -0,0 +1,285 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> expressions,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(expressions)) {
+	for (auto &group : groups) {
+		group_columns.push_back(group->Cast<BoundReferenceExpression>().index);
+	}
+	for (auto &expr : aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		D_ASSERT(!aggr.IsDistinct() && !aggr.filter);
+		D_ASSERT(aggr.function.combine);
+		for (auto &child : aggr.children) {
+			payload_columns.push_back(child->Cast<BoundReferenceExpression>().index);
+			payload_types.push_back(child->return_type);
+		}
+	}
+}
+
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ClientContext &context, const PhysicalStreamingAggregate &op)
+	    : allocator(BufferAllocator::Get(context)), previous_allocator(BufferAllocator::Get(context)),
+	      row_state(allocator), has_group(false), addresses(LogicalType::POINTER), group_starts(STANDARD_VECTOR_SIZE),
+	      distinct_sel(STANDARD_VECTOR_SIZE), remaining_sel(STANDARD_VECTOR_SIZE), current_rows(STANDARD_VECTOR_SIZE),
+	      previous_rows(STANDARD_VECTOR_SIZE), remaining_current_rows(STANDARD_VECTOR_SIZE),
+	      remaining_previous_rows(STANDARD_VECTOR_SIZE) {
+		vector<BoundAggregateExpression *> bindings;
+		for (auto &expr : op.aggregates) {
+			bindings.push_back(&expr->Cast<BoundAggregateExpression>());
+		}
+		layout.Initialize(AggregateObject::CreateAggregateObjects(bindings));
+		// the current group, and at most one new group per row of the input
+		states = make_unsafe_uniq_array<data_t>((STANDARD_VECTOR_SIZE + 1) * layout.GetRowWidth());
+
+		if (!op.payload_types.empty()) {
+			payload.InitializeEmpty(op.payload_types);
+		}
+		// to compare every row with the previous row, we compare rows [1, count) with rows [0, count - 1)
+		for (idx_t i = 0; i + 1 < STANDARD_VECTOR_SIZE; i++) {
+			current_rows.set_index(i, i + 1);
+			previous_rows.set_index(i, i);
+		}
+	}
+
+	~StreamingAggregateState() override {
+		if (has_group) {
+			DestroyStates(0, 1);
+		}
+	}
+
+	//! The layout of the aggregate states of a single group
+	TupleDataLayout layout;
+	//! The arena the aggregates allocate in during the current input
+	ArenaAllocator allocator;
+	//! The arena with the allocations of the previous inputs, back to the input where the current group started
+	ArenaAllocator previous_allocator;
+	RowOperationsState row_state;
+	//! The aggregate states, the current group is always in the first slot
+	unsafe_unique_array<data_t> states;
+	//! The inputs of the aggregates
+	DataChunk payload;
+	//! Whether or not there is a current group
+	bool has_group;
+	//! The values of the groups of the current group
+	vector<Value> current_group;
+
+	//! The addresses of the aggregate states
+	Vector addresses;
+	//! The rows of the input that start a new group
+	SelectionVector group_starts;
+	bool is_group_start[STANDARD_VECTOR_SIZE];
+	SelectionVector distinct_sel;
+	SelectionVector remaining_sel;
+	SelectionVector current_rows;
+	SelectionVector previous_rows;
+	//! The rows that are equal on all groups compared so far, which are compared on the next group
+	SelectionVector remaining_current_rows;
+	SelectionVector remaining_previous_rows;
+
+public:
+	data_ptr_t GetState(idx_t slot) {
+		return states.get() + slot * layout.GetRowWidth();
+	}
+
+	void SetAddresses(idx_t first_slot, idx_t count) {
+		auto pointers = FlatVector::GetData<data_ptr_t>(addresses);
+		for (idx_t i = 0; i < count; i++) {
+			pointers[i] = GetState(first_slot + i);
+		}
+	}
+
+	void InitializeStates(idx_t first_slot, idx_t count) {
+		SetAddresses(first_slot, count);
+		RowOperations::InitializeStates(layout, addresses, *FlatVector::IncrementalSelectionVector(), count);
+	}
+
+	void DestroyStates(idx_t first_slot, idx_t count) {
+		if (!layout.HasDestructor()) {
+			return;
+		}
+		SetAddresses(first_slot, count);
+		RowOperations::DestroyStates(row_state, layout, addresses, count);
+	}
+
+	void SetCurrentGroup(DataChunk &input, const vector<idx_t> &group_columns, idx_t row) {
+		current_group.clear();
+		for (auto &column : group_columns) {
+			current_group.push_back(input.GetValue(column, row));
+		}
+	}
+};
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context.client, *this);
+}
+
+idx_t PhysicalStreamingAggregate::FindGroupStarts(DataChunk &input, StreamingAggregateState &state) const {
+	const auto count = input.size();
+	// the first row starts a new group if it differs from the current group
+	memset(state.is_group_start, 0, count * sizeof(bool));
+	for (idx_t group_idx = 0; group_idx < group_columns.size(); group_idx++) {
+		if (!Value::NotDistinctFrom(input.GetValue(group_columns[group_idx], 0), state.current_group[group_idx])) {
+			state.is_group_start[0] = true;
+			break;
+		}
+	}
+
+	// every other row starts a new group if it differs from the previous row in any of the groups
+	idx_t remaining_count = count - 1;
+	const SelectionVector *remaining = nullptr;
+	for (idx_t group_idx = 0; group_idx < group_columns.size() && remaining_count > 0; group_idx++) {
+		auto &column = input.data[group_columns[group_idx]];
+		// the comparison reads rows [0, remaining_count) of its inputs, so only the remaining rows are sliced
+		auto current_rows = &state.current_rows;
+		auto previous_rows = &state.previous_rows;
+		if (remaining) {
+			for (idx_t i = 0; i < remaining_count; i++) {
+				const auto row = remaining->get_index(i);
+				state.remaining_current_rows.set_index(i, row + 1);
+				state.remaining_previous_rows.set_index(i, row);
+			}
+			current_rows = &state.remaining_current_rows;
+			previous_rows = &state.remaining_previous_rows;
+		}
+		Vector current(column, *current_rows, remaining_count);
+		Vector previous(column, *previous_rows, remaining_count);
+		auto distinct_count = VectorOperations::DistinctFrom(current, previous, remaining, remaining_count,
+		                                                     &state.distinct_sel, &state.remaining_sel);
+		for (idx_t i = 0; i < distinct_count; i++) {
+			state.is_group_start[state.distinct_sel.get_index(i) + 1] = true;
+		}
+		remaining_count -= distinct_count;
+		remaining = &state.remaining_sel;
+	}
+
+	idx_t start_count = 0;
+	for (idx_t row = 0; row < count; row++) {
+		if (state.is_group_start[row]) {
+			state.group_starts.set_index(start_count++, row);
+		}
+	}
+	return start_count;
+}
+
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+	if (!state.has_group) {
+		// the first row starts the first group
+		state.SetCurrentGroup(input, group_columns, 0);
+		state.InitializeStates(0, 1);
+		state.has_group = true;
+	}
+
+	// every new group finishes the group before it: the finished groups are in slots [0, start_count)
+	const auto start_count = FindGroupStarts(input, state);
+	state.InitializeStates(1, start_count);
+
+	// update the states of all groups at once
+	auto pointers = FlatVector::GetData<data_ptr_t>(state.addresses);
+	idx_t slot = 0;
+	for (idx_t row = 0; row < count; row++) {
+		if (slot < start_count && state.group_starts.get_index(slot) == row) {
+			slot++;
+		}
+		pointers[row] = state.GetState(slot);
+	}
+	for (idx_t i = 0; i < payload_columns.size(); i++) {
+		state.payload.data[i].Reference(input.data[payload_columns[i]]);
+	}
+	state.payload.SetCardinality(count);
+	VectorOperations::AddInPlace(state.addresses, state.layout.GetAggrOffset(), count);
+	idx_t payload_idx = 0;
+	for (auto &aggr : state.layout.GetAggregates()) {
+		RowOperations::UpdateStates(state.row_state, aggr, state.addresses, state.payload, payload_idx, count);
+		// move to the state of the next aggregate
+		payload_idx += aggr.child_count;
+		VectorOperations::AddInPlace(state.addresses, aggr.payload_size, count);
+	}
+	if (start_count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// emit the finished groups
+	chunk.SetCardinality(start_count);
+	for (idx_t group_idx = 0; group_idx < group_columns.size(); group_idx++) {
+		auto &target = chunk.data[group_idx];
+		VectorOperations::Copy(input.data[group_columns[group_idx]], target, state.group_starts, start_count - 1, 0,
+		                       1);
+		target.SetValue(0, state.current_group[group_idx]);
+	}
+	state.SetAddresses(0, start_count);
+	RowOperations::FinalizeStates(state.row_state, state.layout, state.addresses, chunk, group_columns.size());
+	state.DestroyStates(0, start_count);
+
+	// the last group that was started is the new current group, move its state to the first slot
+	state.InitializeStates(0, 1);
+	Vector source(LogicalType::POINTER);
+	Vector target(LogicalType::POINTER);
+	FlatVector::GetData<data_ptr_t>(source)[0] = state.GetState(start_count);
+	FlatVector::GetData<data_ptr_t>(target)[0] = state.GetState(0);
+	RowOperations::CombineStates(state.row_state, state.layout, source, target, 1);
+	state.DestroyStates(start_count, 1);
+	state.SetCurrentGroup(input, group_columns, state.group_starts.get_index(start_count - 1));
+
+	// the current group started in this input, so it only references memory that was allocated during this input
+	state.previous_allocator.Destroy();
+	state.allocator.Move(state.previous_allocator);
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.has_group) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+	// emit the last group
+	chunk.SetCardinality(1);
+	for (idx_t group_idx = 0; group_idx < group_columns.size(); group_idx++) {
+		chunk.data[group_idx].SetValue(0, state.current_group[group_idx]);
+	}
+	state.SetAddresses(0, 1);
+	RowOperations::FinalizeStates(state.row_state, state.layout, state.addresses, chunk, group_columns.size());
+	state.DestroyStates(0, 1);
+	state.has_group = false;
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		result += "\n";
+		result += aggregates[i]->GetName();
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -14,6 +14,8 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
 
 #include <functional>
 
@@ -101,6 +103,8 @@ public:
 	unique_ptr<DistinctAggregateState> distinct_state;
 	//! Global arena allocator
 	ArenaAllocator allocator;
+	//! The HLLs of the columns of the sketch table, if the aggregates are answered from them
+	vector<unique_ptr<HyperLogLog>> sketches;
 };
 
 class UngroupedAggregateLocalSinkState : public LocalSinkState {
@@ -159,19 +163,10 @@ public:
 		auto &state = *gstate.distinct_state;
 		D_ASSERT(!data.radix_tables.empty());
 
-		const idx_t aggregate_count = state.radix_states.size();
-		radix_states.resize(aggregate_count);
-
-		auto &distinct_info = *op.distinct_collection_info;
-
-		for (auto &idx : distinct_info.indices) {
-			idx_t table_idx = distinct_info.table_map[idx];
-			if (data.radix_tables[table_idx] == nullptr) {
-				// This aggregate has identical input as another aggregate, so no table is created for it
-				continue;
-			}
-			auto &radix_table = *data.radix_tables[table_idx];
-			radix_states[table_idx] = radix_table.GetLocalSinkState(context);
+		const idx_t table_count = state.radix_states.size();
+		radix_states.resize(table_count);
+		for (idx_t table_idx = 0; table_idx < table_count; table_idx++) {
+			radix_states[table_idx] = data.radix_tables[table_idx]->GetLocalSinkState(context);
 		}
 	}
 };
@@ -187,7 +182,21 @@ bool PhysicalUngroupedAggregate::SinkOrderDependent() const {
 }
 
 unique_ptr<GlobalSinkState> PhysicalUngroupedAggregate::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<UngroupedAggregateGlobalSinkState>(*this, context);
+	auto result = make_uniq<UngroupedAggregateGlobalSinkState>(*this, context);
+	if (sketch_table) {
+		// the aggregates can only be answered from the statistics if they are exact for this transaction
+		auto &table = *sketch_table.get_mutable();
+		auto &transaction = DuckTransaction::Get(context, table.db);
+		for (auto &column_id : sketch_columns) {
+			auto sketch = table.GetDistinctSketch(transaction, column_id);
+			if (!sketch) {
+				result->sketches.clear();
+				break;
+			}
+			result->sketches.push_back(std::move(sketch));
+		}
+	}
+	return std::move(result);
 }
 
 unique_ptr<LocalSinkState> PhysicalUngroupedAggregate::GetLocalSinkState(ExecutionContext &context) const {
@@ -203,38 +212,40 @@ void PhysicalUngroupedAggregate::SinkDistinct(ExecutionContext &context, DataChu
 	D_ASSERT(distinct_data);
 	auto &distinct_state = *global_sink.distinct_state;
 	auto &distinct_info = *distinct_collection_info;
-	auto &distinct_indices = distinct_info.Indices();
 
 	DataChunk empty_chunk;
 
 	auto &distinct_filter = distinct_info.Indices();
 
-	for (auto &idx : distinct_indices) {
-		auto &aggregate = aggregates[idx]->Cast<BoundAggregateExpression>();
-
-		idx_t table_idx = distinct_info.table_map[idx];
-		if (!distinct_data->radix_tables[table_idx]) {
-			// This distinct aggregate shares its data with another
-			continue;
-		}
-		D_ASSERT(distinct_data->radix_tables[table_idx]);
+	for (idx_t table_idx = 0; table_idx < distinct_data->radix_tables.size(); table_idx++) {
 		auto &radix_table = *distinct_data->radix_tables[table_idx];
 		auto &radix_global_sink = *distinct_state.radix_states[table_idx];
 		auto &radix_local_sink = *sink.radix_states[table_idx];
 		OperatorSinkInput sink_input {radix_global_sink, radix_local_sink, input.interrupt_state};
 
-		if (aggregate.filter) {
-			// The hashtable can apply a filter, but only on the payload
-			// And in our case, we need to filter the groups (the distinct aggr children)
+		// Add the different inputs of the aggregates that share this table
+		for (auto &idx : distinct_info.table_inputs[table_idx]) {
+			auto &aggregate = aggregates[idx]->Cast<BoundAggregateExpression>();
 
-			// Apply the filter before inserting into the hashtable
-			auto &filtered_data = sink.filter_set.GetFilterData(idx);
-			idx_t count = filtered_data.ApplyFilter(chunk);
-			filtered_data.filtered_payload.SetCardinality(count);
+			reference<DataChunk> aggregate_input(chunk);
+			if (aggregate.filter) {
+				// The hashtable can apply a filter, but only on the payload
+				// And in our case, we need to filter the groups (the distinct aggr children)
 
-			radix_table.Sink(context, filtered_data.filtered_payload, sink_input, empty_chunk, distinct_filter);
-		} else {
-			radix_table.Sink(context, chunk, sink_input, empty_chunk, distinct_filter);
+				// Apply the filter before inserting into the hashtable
+				auto &filtered_data = sink.filter_set.GetFilterData(idx);
+				idx_t count = filtered_data.ApplyFilter(chunk);
+				filtered_data.filtered_payload.SetCardinality(count);
+				aggregate_input = filtered_data.filtered_payload;
+			}
+
+			if (distinct_info.IsTagged(table_idx)) {
+				DataChunk table_input;
+				distinct_data->PopulateTableInput(idx, aggregate_input.get(), table_input);
+				radix_table.Sink(context, table_input, sink_input, empty_chunk, distinct_filter);
+			} else {
+				radix_table.Sink(context, aggregate_input.get(), sink_input, empty_chunk, distinct_filter);
+			}
 		}
 	}
 }
@@ -242,6 +253,10 @@ void PhysicalUngroupedAggregate::SinkDistinct(ExecutionContext &context, DataChu
 SinkResultType PhysicalUngroupedAggregate::Sink(ExecutionContext &context, DataChunk &chunk,
                                                 OperatorSinkInput &input) const {
 	auto &sink = input.local_state.Cast<UngroupedAggregateLocalSinkState>();
+	if (!input.global_state.Cast<UngroupedAggregateGlobalSinkState>().sketches.empty()) {
+		// the aggregates are answered from the statistics, there is no need to read the input
+		return SinkResultType::FINISHED;
+	}
 
 	// perform the aggregation inside the local state
 	sink.Reset();
@@ -410,29 +425,11 @@ private:
 
 void UngroupedDistinctAggregateFinalizeEvent::Schedule() {
 	D_ASSERT(gstate.distinct_state);
-	auto &aggregates = op.aggregates;
 	auto &distinct_data = *op.distinct_data;
 
-	idx_t payload_idx = 0;
-	idx_t next_payload_idx = 0;
-	for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
-		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
-
-		// Forward the payload idx
-		payload_idx = next_payload_idx;
-		next_payload_idx = payload_idx + aggregate.children.size();
-
-		// If aggregate is not distinct, skip it
-		if (!distinct_data.IsDistinct(agg_idx)) {
-			global_source_states.push_back(nullptr);
-			continue;
-		}
-		D_ASSERT(distinct_data.info.table_map.count(agg_idx));
-
-		// Create global state for scanning
-		auto table_idx = distinct_data.info.table_map.at(agg_idx);
-		auto &radix_table_p = *distinct_data.radix_tables[table_idx];
-		global_source_states.push_back(radix_table_p.GetGlobalSourceState(context));
+	// Create global states for scanning
+	for (auto &radix_table : distinct_data.radix_tables) {
+		global_source_states.push_back(radix_table->GetGlobalSourceState(context));
 	}
 
 	const idx_t n_threads = TaskScheduler::GetScheduler(context).NumberOfThreads();
@@ -466,28 +463,25 @@ void UngroupedDistinctAggregateFinalizeTask::AggregateDistinct() {
 
 	auto &finalize_event = event->Cast<UngroupedDistinctAggregateFinalizeEvent>();
 
-	// Now loop through the distinct aggregates, scanning the distinct HTs
-	idx_t payload_idx = 0;
-	idx_t next_payload_idx = 0;
-	for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
-		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
-
-		// Forward the payload idx
-		payload_idx = next_payload_idx;
-		next_payload_idx = payload_idx + aggregate.children.size();
-
-		// If aggregate is not distinct, skip it
-		if (!distinct_data.IsDistinct(agg_idx)) {
-			continue;
-		}
+	// For every table and every input (tag) of the table, the distinct aggregates with that input
+	auto &info = distinct_data.info;
+	vector<vector<vector<idx_t>>> table_aggregates(distinct_data.radix_tables.size());
+	for (idx_t table_idx = 0; table_idx < table_aggregates.size(); table_idx++) {
+		table_aggregates[table_idx].resize(info.table_inputs[table_idx].size());
+	}
+	for (auto &agg_idx : info.indices) {
+		table_aggregates[info.table_map.at(agg_idx)][info.tag_map.at(agg_idx)].push_back(agg_idx);
+	}
 
-		const auto table_idx = distinct_data.info.table_map.at(agg_idx);
+	// Now loop through the distinct HTs, and update the aggregates with their input
+	SelectionVector tag_sel(STANDARD_VECTOR_SIZE);
+	for (idx_t table_idx = 0; table_idx < distinct_data.radix_tables.size(); table_idx++) {
 		auto &radix_table = *distinct_data.radix_tables[table_idx];
 		auto lstate = radix_table.GetLocalSourceState(execution_context);
 
 		auto &sink = *distinct_state.radix_states[table_idx];
 		InterruptState interrupt_state;
-		OperatorSourceInput source_input {*finalize_event.global_source_states[agg_idx], *lstate, interrupt_state};
+		OperatorSourceInput source_input {*finalize_event.global_source_states[table_idx], *lstate, interrupt_state};
 
 		DataChunk output_chunk;
 		output_chunk.Initialize(executor.context, distinct_state.distinct_output_chunks[table_idx]->GetTypes());
@@ -496,7 +490,7 @@ void UngroupedDistinctAggregateFinalizeTask::AggregateDistinct() {
 		payload_chunk.InitializeEmpty(distinct_data.grouped_aggregate_data[table_idx]->group_types);
 		payload_chunk.SetCardinality(0);
 
-		AggregateInputData aggr_input_data(aggregate.bind_info.get(), allocator);
+		const auto tagged = info.IsTagged(table_idx);
 		while (true) {
 			output_chunk.Reset();
 
@@ -509,28 +503,43 @@ void UngroupedDistinctAggregateFinalizeTask::AggregateDistinct() {
 				    "Unexpected interrupt from radix table GetData in UngroupedDistinctAggregateFinalizeTask");
 			}
 
-			// We dont need to resolve the filter, we already did this in Sink
-			idx_t payload_cnt = aggregate.children.size();
-			for (idx_t i = 0; i < payload_cnt; i++) {
-				payload_chunk.data[i].Reference(output_chunk.data[i]);
-			}
-			payload_chunk.SetCardinality(output_chunk);
-
+			for (idx_t tag = 0; tag < table_aggregates[table_idx].size(); tag++) {
+				// We dont need to resolve the filter, we already did this in Sink
+				for (idx_t i = 0; i < output_chunk.ColumnCount(); i++) {
+					payload_chunk.data[i].Reference(output_chunk.data[i]);
+				}
+				payload_chunk.SetCardinality(output_chunk);
+
+				if (tagged) {
+					// Only the rows with the tag of this input belong to the aggregates
+					Vector tag_vector(Value::UTINYINT(static_cast<uint8_t>(tag)));
+					auto count = VectorOperations::Equals(output_chunk.data[output_chunk.ColumnCount() - 1],
+					                                      tag_vector, nullptr, output_chunk.size(), &tag_sel, nullptr);
+					if (count == 0) {
+						continue;
+					}
+					payload_chunk.Slice(tag_sel, count);
+				}
+
+				for (auto &agg_idx : table_aggregates[table_idx][tag]) {
+					auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
+					AggregateInputData aggr_input_data(aggregate.bind_info.get(), allocator);
 #ifdef DEBUG
-			gstate.state.counts[agg_idx] += payload_chunk.size();
+					gstate.state.counts[agg_idx] += payload_chunk.size();
 #endif
 
-			// Update the aggregate state
-			auto start_of_input = payload_cnt ? &payload_chunk.data[0] : nullptr;
-			aggregate.function.simple_update(start_of_input, aggr_input_data, payload_cnt,
-			                                 state.aggregates[agg_idx].get(), payload_chunk.size());
+					// Update the aggregate state
+					idx_t payload_cnt = aggregate.children.size();
+					auto start_of_input = payload_cnt ? &payload_chunk.data[0] : nullptr;
+					aggregate.function.simple_update(start_of_input, aggr_input_data, payload_cnt,
+					                                 state.aggregates[agg_idx].get(), payload_chunk.size());
+				}
+			}
 		}
 	}
 
 	// After scanning the distinct HTs, we can combine the thread-local agg states with the thread-global
 	lock_guard<mutex> guard(finalize_event.lock);
-	payload_idx = 0;
-	next_payload_idx = 0;
 	for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
 		if (!distinct_data.IsDistinct(agg_idx)) {
 			continue;
@@ -603,6 +612,12 @@ SourceResultType PhysicalUngroupedAggregate::GetData(ExecutionContext &context,
 
 	// initialize the result chunk with the aggregate values
 	chunk.SetCardinality(1);
+	if (!gstate.sketches.empty()) {
+		for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+			chunk.SetValue(aggr_idx, 0, Value::BIGINT(int64_t(gstate.sketches[aggr_idx]->Count())));
+		}
+		return SourceResultType::FINISHED;
+	}
 	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
 		auto &aggregate = aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
 
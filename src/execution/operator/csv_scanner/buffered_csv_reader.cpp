@@ -9,6 +9,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/operator/scan/csv/csv_sniffer.hpp"
 #include "duckdb/execution/operator/scan/csv/csv_state_machine.hpp"
+#include "duckdb/execution/operator/scan/csv/csv_structural_scanner.hpp"
 #include "duckdb/function/scalar/strftime_format.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/database.hpp"
@@ -202,6 +203,9 @@ bool BufferedCSVReader::TryParseCSV(ParserMode parser_mode, DataChunk &insert_ch
 
 	idx_t line_start = position;
 	idx_t line_size = 0;
+	auto &state_machine_options = options.dialect_options.state_machine_options;
+	auto unquoted_scanner = CSVStructuralScanner::Unquoted(state_machine_options.delimiter);
+	auto quoted_scanner = CSVStructuralScanner::Quoted(state_machine_options.quote, state_machine_options.escape);
 	// read values into the buffer (if any)
 	if (position >= buffer_size) {
 		if (!ReadBuffer(start, line_start)) {
@@ -231,6 +235,13 @@ normal:
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	do {
 		for (; position < buffer_size; position++) {
+			// skip over the content of the value
+			auto next_position = unquoted_scanner.Find(buffer.get(), position, buffer_size);
+			line_size += next_position - position;
+			position = next_position;
+			if (position >= buffer_size) {
+				break;
+			}
 			line_size++;
 			if (buffer[position] == options.dialect_options.state_machine_options.delimiter) {
 				// delimiter: end the value and add it to the chunk
@@ -308,6 +319,13 @@ in_quotes:
 	line_size++;
 	do {
 		for (; position < buffer_size; position++) {
+			// skip over the content of the quoted value
+			auto next_position = quoted_scanner.Find(buffer.get(), position, buffer_size);
+			line_size += next_position - position;
+			position = next_position;
+			if (position >= buffer_size) {
+				break;
+			}
 			line_size++;
 			if (buffer[position] == options.dialect_options.state_machine_options.quote) {
 				// quote: move to unquoted state
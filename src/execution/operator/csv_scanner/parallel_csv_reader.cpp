@@ -285,6 +285,9 @@ bool ParallelCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error
 		return true;
 	}
 	D_ASSERT(end_buffer <= buffer_size);
+	auto &state_machine_options = options.dialect_options.state_machine_options;
+	auto unquoted_scanner = CSVStructuralScanner::Unquoted(state_machine_options.delimiter);
+	auto quoted_scanner = CSVStructuralScanner::Quoted(state_machine_options.quote, state_machine_options.escape);
 	bool finished_chunk = false;
 	idx_t column = 0;
 	idx_t offset = 0;
@@ -332,6 +335,11 @@ normal : {
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	for (; position_buffer < end_buffer; position_buffer++) {
+		// skip over the content of the value
+		position_buffer = buffer->Find(unquoted_scanner, position_buffer, end_buffer);
+		if (position_buffer >= end_buffer) {
+			break;
+		}
 		auto c = (*buffer)[position_buffer];
 		if (c == options.dialect_options.state_machine_options.delimiter) {
 			// Check if previous character is a quote, if yes, this means we are in a non-initialized quoted value
@@ -477,6 +485,11 @@ in_quotes:
 	has_quotes = true;
 	position_buffer++;
 	for (; position_buffer < end_buffer; position_buffer++) {
+		// skip over the content of the quoted value
+		position_buffer = buffer->Find(quoted_scanner, position_buffer, end_buffer);
+		if (position_buffer >= end_buffer) {
+			break;
+		}
 		auto c = (*buffer)[position_buffer];
 		if (c == options.dialect_options.state_machine_options.quote) {
 			// quote: move to unquoted state
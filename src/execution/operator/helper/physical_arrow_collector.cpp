@@ -0,0 +1,143 @@
+#include "duckdb/execution/operator/helper/physical_arrow_collector.hpp"
+
+#include "duckdb/common/arrow/arrow_appender.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/arrow_query_result.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+
+namespace duckdb {
+
+PhysicalArrowCollector::PhysicalArrowCollector(PreparedStatementData &data, bool parallel, bool use_batch_index,
+                                               idx_t batch_size)
+    : PhysicalResultCollector(data), parallel(parallel), use_batch_index(use_batch_index),
+      record_batch_size(batch_size) {
+	D_ASSERT(record_batch_size > 0);
+}
+
+unique_ptr<PhysicalResultCollector> PhysicalArrowCollector::Create(ClientContext &context, PreparedStatementData &data,
+                                                                   idx_t batch_size) {
+	if (!PhysicalPlanGenerator::PreserveInsertionOrder(context, *data.plan)) {
+		// the plan is not order preserving: every thread converts and collects its own arrays
+		return make_uniq_base<PhysicalResultCollector, PhysicalArrowCollector>(data, true, false, batch_size);
+	} else if (!PhysicalPlanGenerator::UseBatchIndex(context, *data.plan)) {
+		// the plan is order preserving, but we cannot use the batch index: convert on a single thread
+		return make_uniq_base<PhysicalResultCollector, PhysicalArrowCollector>(data, false, false, batch_size);
+	} else {
+		// the plan is order preserving and the sources all support batch indexes: convert in parallel, and order the
+		// arrays by batch index afterwards
+		return make_uniq_base<PhysicalResultCollector, PhysicalArrowCollector>(data, true, true, batch_size);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+//! The arrays of a batch, in the order in which they were appended
+using arrow_batch_map_t = map<idx_t, vector<unique_ptr<ArrowArrayWrapper>>>;
+
+class ArrowCollectorGlobalState : public GlobalSinkState {
+public:
+	mutex glock;
+	arrow_batch_map_t batches;
+	unique_ptr<ArrowQueryResult> result;
+};
+
+class ArrowCollectorLocalState : public LocalSinkState {
+public:
+	explicit ArrowCollectorLocalState(ClientContext &context) : options(context.GetClientProperties()) {
+	}
+
+	ClientProperties options;
+	//! The appender of the array that is currently being filled (if any)
+	unique_ptr<ArrowAppender> appender;
+	//! The batch the current array belongs to
+	idx_t current_batch = 0;
+	//! The finished arrays of this thread
+	arrow_batch_map_t batches;
+
+public:
+	void FinishArray() {
+		if (!appender) {
+			return;
+		}
+		auto array = make_uniq<ArrowArrayWrapper>();
+		array->arrow_array = appender->Finalize();
+		appender.reset();
+		batches[current_batch].push_back(std::move(array));
+	}
+};
+
+SinkResultType PhysicalArrowCollector::Sink(ExecutionContext &context, DataChunk &chunk,
+                                            OperatorSinkInput &input) const {
+	auto &state = input.local_state.Cast<ArrowCollectorLocalState>();
+	auto batch_index = use_batch_index ? state.partition_info.batch_index.GetIndex() : 0;
+	if (batch_index != state.current_batch) {
+		// arrays never span multiple batches, otherwise we could not order them
+		state.FinishArray();
+		state.current_batch = batch_index;
+	}
+	idx_t offset = 0;
+	while (offset < chunk.size()) {
+		if (!state.appender) {
+			state.appender = make_uniq<ArrowAppender>(types, record_batch_size, state.options);
+		}
+		auto to_append = MinValue<idx_t>(chunk.size() - offset, record_batch_size - state.appender->RowCount());
+		state.appender->Append(chunk, offset, offset + to_append, chunk.size());
+		offset += to_append;
+		if (state.appender->RowCount() >= record_batch_size) {
+			state.FinishArray();
+		}
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalArrowCollector::Combine(ExecutionContext &context,
+                                                      OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<ArrowCollectorGlobalState>();
+	auto &state = input.local_state.Cast<ArrowCollectorLocalState>();
+	state.FinishArray();
+
+	lock_guard<mutex> lock(gstate.glock);
+	for (auto &entry : state.batches) {
+		auto &arrays = gstate.batches[entry.first];
+		for (auto &array : entry.second) {
+			arrays.push_back(std::move(array));
+		}
+	}
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalArrowCollector::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                  OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<ArrowCollectorGlobalState>();
+	vector<unique_ptr<ArrowArrayWrapper>> arrays;
+	for (auto &entry : gstate.batches) {
+		for (auto &array : entry.second) {
+			arrays.push_back(std::move(array));
+		}
+	}
+	gstate.batches.clear();
+	auto result = make_uniq<ArrowQueryResult>(statement_type, properties, names, types, context.GetClientProperties(),
+	                                          record_batch_size);
+	result->SetArrowData(std::move(arrays));
+	gstate.result = std::move(result);
+	return SinkFinalizeType::READY;
+}
+
+unique_ptr<LocalSinkState> PhysicalArrowCollector::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<ArrowCollectorLocalState>(context.client);
+}
+
+unique_ptr<GlobalSinkState> PhysicalArrowCollector::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<ArrowCollectorGlobalState>();
+}
+
+unique_ptr<QueryResult> PhysicalArrowCollector::GetResult(GlobalSinkState &state) {
+	auto &gstate = state.Cast<ArrowCollectorGlobalState>();
+	D_ASSERT(gstate.result);
+	return std::move(gstate.result);
+}
+
+} // namespace duckdb
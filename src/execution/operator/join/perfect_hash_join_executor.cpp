@@ -17,7 +17,7 @@ bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
-bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::BuildPerfectHashTable() {
 	// First, allocate memory for each build column
 	auto build_size = perfect_join_statistics.build_range + 1;
 	for (const auto &type : ht.build_types) {
@@ -30,11 +30,17 @@ bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
 
 	// Now fill columns with build data
 
-	return FullScanHashTable(key_type);
+	return FullScanHashTable();
 }
 
-bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::FullScanHashTable() {
 	auto &data_collection = ht.GetDataCollection();
+	for (idx_t key_idx = 0; key_idx < ht.equality_types.size(); key_idx++) {
+		if (perfect_join_statistics.build_min[key_idx].IsNull() ||
+		    perfect_join_statistics.build_max[key_idx].IsNull()) {
+			return false;
+		}
+	}
 
 	// TODO: In a parallel finalize: One should exclusively lock and each thread should do one part of the code below.
 	Vector tuples_addresses(LogicalType::POINTER, ht.Count()); // allocate space for all the tuples
@@ -48,19 +54,32 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 		key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
 	}
 
-	// Scan the build keys in the hash table
-	Vector build_vector(key_type, key_count);
-	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, 0);
+	// Scan the build keys in the hash table, and compute the index of every tuple in the perfect hash table
+	// keys out of the range are removed from the (initially sequential) tuple selection
+	auto indices = make_unsafe_uniq_array<idx_t>(key_count + 1);
+	memset(indices.get(), 0, sizeof(idx_t) * key_count);
+	SelectionVector sel_tuples(key_count + 1);
+	for (idx_t i = 0; i < key_count; i++) {
+		sel_tuples.set_index(i, i);
+	}
+	idx_t sel_count = key_count;
+	for (idx_t key_idx = 0; key_idx < ht.equality_types.size(); key_idx++) {
+		Vector build_vector(ht.equality_types[key_idx], key_count);
+		RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, key_idx);
+		sel_count = ComputeIndexSwitch(key_idx, build_vector, key_count, sel_tuples, sel_count, indices.get());
+	}
 
-	// Now fill the selection vector using the build keys and create a sequential vector
+	// Now fill the selection vector of the perfect hash table, bailing out on duplicate keys
 	// TODO: add check for fast pass when probe is part of build domain
 	SelectionVector sel_build(key_count + 1);
-	SelectionVector sel_tuples(key_count + 1);
-	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, key_count);
-
-	// early out
-	if (!success) {
-		return false;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto idx = indices[sel_tuples.get_index(i)];
+		if (bitmap_build_idx[idx]) {
+			return false;
+		}
+		bitmap_build_idx[idx] = true;
+		unique_keys++;
+		sel_build.set_index(i, idx);
 	}
 	if (unique_keys == perfect_join_statistics.build_range + 1 && !ht.has_null) {
 		perfect_join_statistics.is_build_dense = true;
@@ -84,59 +103,58 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 	return true;
 }
 
-bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec,
-                                                             SelectionVector &seq_sel_vec, idx_t count) {
+idx_t PerfectHashJoinExecutor::ComputeIndexSwitch(idx_t key_idx, Vector &source, idx_t count, SelectionVector &sel,
+                                                  idx_t sel_count, idx_t indices[]) {
 	switch (source.GetType().InternalType()) {
 	case PhysicalType::INT8:
-		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeIndex<int8_t>(key_idx, source, count, sel, sel_count, indices);
 	case PhysicalType::INT16:
-		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeIndex<int16_t>(key_idx, source, count, sel, sel_count, indices);
 	case PhysicalType::INT32:
-		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeIndex<int32_t>(key_idx, source, count, sel, sel_count, indices);
 	case PhysicalType::INT64:
-		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeIndex<int64_t>(key_idx, source, count, sel, sel_count, indices);
 	case PhysicalType::UINT8:
-		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeIndex<uint8_t>(key_idx, source, count, sel, sel_count, indices);
 	case PhysicalType::UINT16:
-		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeIndex<uint16_t>(key_idx, source, count, sel, sel_count, indices);
 	case PhysicalType::UINT32:
-		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeIndex<uint32_t>(key_idx, source, count, sel, sel_count, indices);
 	case PhysicalType::UINT64:
-		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count);
+		return TemplatedComputeIndex<uint64_t>(key_idx, source, count, sel, sel_count, indices);
 	default:
 		throw NotImplementedException("Type not supported for perfect hash join");
 	}
 }
 
 template <typename T>
-bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
-                                                                SelectionVector &seq_sel_vec, idx_t count) {
-	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
-		return false;
-	}
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
+idx_t PerfectHashJoinExecutor::TemplatedComputeIndex(idx_t key_idx, Vector &source, idx_t count, SelectionVector &sel,
+                                                     idx_t sel_count, idx_t indices[]) {
+	auto min_value = perfect_join_statistics.build_min[key_idx].GetValueUnsafe<T>();
+	auto max_value = perfect_join_statistics.build_max[key_idx].GetValueUnsafe<T>();
+	auto multiplier = perfect_join_statistics.key_multipliers[key_idx];
+
 	UnifiedVectorFormat vector_data;
 	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	// generate the selection vector
-	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-		auto data_idx = vector_data.sel->get_index(i);
+	auto data = UnifiedVectorFormat::GetData<T>(vector_data);
+	auto &validity = vector_data.validity;
+	// the selection is compacted in place: rows are only ever moved to a lower position
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto row_idx = sel.get_index(i);
+		auto data_idx = vector_data.sel->get_index(row_idx);
+		if (!validity.RowIsValid(data_idx)) {
+			continue;
+		}
 		auto input_value = data[data_idx];
-		// add index to selection vector if value in the range
+		// keep the row if the value is in the range
 		if (min_value <= input_value && input_value <= max_value) {
-			auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-			sel_vec.set_index(sel_idx, idx);
-			if (bitmap_build_idx[idx]) {
-				return false;
-			} else {
-				bitmap_build_idx[idx] = true;
-				unique_keys++;
-			}
-			seq_sel_vec.set_index(sel_idx++, i);
+			// subtract min value to get the offset of the key
+			indices[row_idx] += idx_t(input_value - min_value) * multiplier;
+			sel.set_index(result_count++, row_idx);
 		}
 	}
-	return true;
+	return result_count;
 }
 
 //===--------------------------------------------------------------------===//
@@ -152,6 +170,7 @@ public:
 		build_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 		probe_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
 		seq_sel_vec.Initialize(STANDARD_VECTOR_SIZE);
+		indices = make_unsafe_uniq_array<idx_t>(STANDARD_VECTOR_SIZE);
 	}
 
 	DataChunk join_keys;
@@ -159,6 +178,8 @@ public:
 	SelectionVector build_sel_vec;
 	SelectionVector probe_sel_vec;
 	SelectionVector seq_sel_vec;
+	//! The index of every probe row in the perfect hash table
+	unsafe_unique_array<idx_t> indices;
 };
 
 unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
@@ -175,11 +196,28 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	// fetch the join keys from the chunk
 	state.join_keys.Reset();
 	state.probe_executor.Execute(input, state.join_keys);
-	// select the keys that are in the min-max range
-	auto &keys_vec = state.join_keys.data[0];
+	// select the keys that are in the min-max range, and compute their index in the perfect hash table
 	auto keys_count = state.join_keys.size();
+	auto indices = state.indices.get();
+	memset(indices, 0, sizeof(idx_t) * keys_count);
+	for (idx_t i = 0; i < keys_count; i++) {
+		state.probe_sel_vec.set_index(i, i);
+	}
+	idx_t sel_count = keys_count;
+	for (idx_t key_idx = 0; key_idx < state.join_keys.ColumnCount(); key_idx++) {
+		auto &keys_vec = state.join_keys.data[key_idx];
+		sel_count = ComputeIndexSwitch(key_idx, keys_vec, keys_count, state.probe_sel_vec, sel_count, indices);
+	}
+	// check for matches in the build
 	// todo: add check for fast pass when probe is part of build domain
-	FillSelectionVectorSwitchProbe(keys_vec, state.build_sel_vec, state.probe_sel_vec, keys_count, probe_sel_count);
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto row_idx = state.probe_sel_vec.get_index(i);
+		auto idx = indices[row_idx];
+		if (bitmap_build_idx[idx]) {
+			state.build_sel_vec.set_index(probe_sel_count, idx);
+			state.probe_sel_vec.set_index(probe_sel_count++, row_idx);
+		}
+	}
 
 	// If build is dense and probe is in build's domain, just reference probe
 	if (perfect_join_statistics.is_build_dense && keys_count == probe_sel_count) {
@@ -199,87 +237,4 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
-void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                             SelectionVector &probe_sel_vec, idx_t count,
-                                                             idx_t &probe_sel_count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		TemplatedFillSelectionVectorProbe<int8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT16:
-		TemplatedFillSelectionVectorProbe<int16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT32:
-		TemplatedFillSelectionVectorProbe<int32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT64:
-		TemplatedFillSelectionVectorProbe<int64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT8:
-		TemplatedFillSelectionVectorProbe<uint8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT16:
-		TemplatedFillSelectionVectorProbe<uint16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT32:
-		TemplatedFillSelectionVectorProbe<uint32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT64:
-		TemplatedFillSelectionVectorProbe<uint64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	default:
-		throw NotImplementedException("Type not supported");
-	}
-}
-
-template <typename T>
-void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                                SelectionVector &probe_sel_vec, idx_t count,
-                                                                idx_t &probe_sel_count) {
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
-
-	UnifiedVectorFormat vector_data;
-	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	auto validity_mask = &vector_data.validity;
-	// build selection vector for non-dense build
-	if (validity_mask->AllValid()) {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	} else {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			if (!validity_mask->RowIsValid(data_idx)) {
-				continue;
-			}
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	}
-}
-
 } // namespace duckdb
@@ -121,6 +121,18 @@ public:
 	unique_ptr<JoinHashTable> hash_table;
 };
 
+string PhysicalHashJoin::ParamsToString() const {
+	auto result = PhysicalComparisonJoin::ParamsToString();
+	if (perfect_join_statistics.is_build_small) {
+		// the build side is small enough for a perfect hash join
+		for (idx_t i = 0; i < perfect_join_statistics.build_min.size(); i++) {
+			result += "Build Min: " + perfect_join_statistics.build_min[i].ToString() + "\n";
+			result += "Build Max: " + perfect_join_statistics.build_max[i].ToString() + "\n";
+		}
+	}
+	return result;
+}
+
 unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &context) const {
 	auto result =
 	    make_uniq<JoinHashTable>(BufferManager::GetBufferManager(context), conditions, build_types, join_type);
@@ -273,13 +285,26 @@ public:
 		} else {
 			// Parallel finalize
 			auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
+			auto &partition_chunk_ends = ht.GetPartitionChunkEnds();
+			const auto align_to_partitions = num_threads <= partition_chunk_ends.size();
+			D_ASSERT(!align_to_partitions || partition_chunk_ends.back() == chunk_count);
 
 			idx_t chunk_idx = 0;
+			idx_t partition_idx = 0;
 			for (idx_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
 				auto chunk_idx_from = chunk_idx;
 				auto chunk_idx_to = MinValue<idx_t>(chunk_idx_from + chunks_per_thread, chunk_count);
-				finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink,
-				                                                         chunk_idx_from, chunk_idx_to, true));
+				if (align_to_partitions) {
+					// Every task inserts whole partitions, so it only writes to their range of the pointer table
+					while (partition_chunk_ends[partition_idx] < chunk_idx_to) {
+						partition_idx++;
+					}
+					chunk_idx_to = partition_chunk_ends[partition_idx];
+				}
+				if (chunk_idx_to > chunk_idx_from) {
+					finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink,
+					                                                         chunk_idx_from, chunk_idx_to, true));
+				}
 				chunk_idx = chunk_idx_to;
 				if (chunk_idx == chunk_count) {
 					break;
@@ -395,9 +420,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	// check for possible perfect hash table
 	auto use_perfect_hash = sink.perfect_join_executor->CanDoPerfectHashJoin();
 	if (use_perfect_hash) {
-		D_ASSERT(ht.equality_types.size() == 1);
-		auto key_type = ht.equality_types[0];
-		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable(key_type);
+		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable();
 	}
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
@@ -1,16 +1,25 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
+#include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
@@ -149,10 +158,148 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Gets the input column of an expression that keeps equal values equal and distinct values distinct
+static bool GetInjectiveColumn(const Expression &expr, idx_t &column) {
+	switch (expr.type) {
+	case ExpressionType::BOUND_REF:
+		column = expr.Cast<BoundReferenceExpression>().index;
+		return true;
+	case ExpressionType::BOUND_FUNCTION: {
+		// (de)compression of compressed materialization
+		auto &function = expr.Cast<BoundFunctionExpression>();
+		if (!StringUtil::StartsWith(function.function.name, "__internal_compress") &&
+		    !StringUtil::StartsWith(function.function.name, "__internal_decompress")) {
+			return false;
+		}
+		return GetInjectiveColumn(*function.children[0], column);
+	}
+	default:
+		return false;
+	}
+}
+
+static bool GroupsAreOrdered(const vector<BoundOrderByNode> &orders, const vector<idx_t> &columns) {
+	// the rows of a group are adjacent if the input is ordered on the groups first (in any order or direction)
+	unordered_set<idx_t> group_columns(columns.begin(), columns.end());
+	unordered_set<idx_t> remaining_columns = group_columns;
+	for (idx_t order_idx = 0; order_idx < orders.size() && !remaining_columns.empty(); order_idx++) {
+		auto &expr = *orders[order_idx].expression;
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		auto column = expr.Cast<BoundReferenceExpression>().index;
+		if (group_columns.find(column) == group_columns.end()) {
+			return false;
+		}
+		remaining_columns.erase(column);
+	}
+	return remaining_columns.empty();
+}
+
+static bool CanUseStreamingAggregate(LogicalAggregate &op) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct() || aggregate.filter || !aggregate.function.combine) {
+			return false;
+		}
+	}
+	vector<idx_t> columns;
+	for (auto &group : op.groups) {
+		idx_t column;
+		if (!GetInjectiveColumn(*group, column)) {
+			return false;
+		}
+		columns.push_back(column);
+	}
+	// follow the group columns down to an ORDER BY, through operators that keep the order
+	reference<LogicalOperator> child = *op.children[0];
+	while (true) {
+		switch (child.get().type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &projection = child.get().Cast<LogicalProjection>();
+			for (auto &column : columns) {
+				if (!GetInjectiveColumn(*projection.expressions[column], column)) {
+					return false;
+				}
+			}
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_FILTER: {
+			auto &filter = child.get().Cast<LogicalFilter>();
+			if (!filter.projection_map.empty()) {
+				for (auto &column : columns) {
+					column = filter.projection_map[column];
+				}
+			}
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_ORDER_BY: {
+			auto &order = child.get().Cast<LogicalOrder>();
+			if (!order.projections.empty()) {
+				for (auto &column : columns) {
+					column = order.projections[column];
+				}
+			}
+			return GroupsAreOrdered(order.orders, columns);
+		}
+		case LogicalOperatorType::LOGICAL_TOP_N:
+			return GroupsAreOrdered(child.get().Cast<LogicalTopN>().orders, columns);
+		default:
+			return false;
+		}
+		child = *child.get().children[0];
+	}
+}
+
+//! Checks if the aggregates are approx_count_distinct over entire columns of a base table. The HLLs of the distinct
+//! statistics of the table are computed in the same way, so they can be used instead of scanning the table.
+static void InitializeSketchTable(PhysicalUngroupedAggregate &op, PhysicalOperator &child) {
+	if (child.type != PhysicalOperatorType::PROJECTION || child.children[0]->type != PhysicalOperatorType::TABLE_SCAN) {
+		return;
+	}
+	auto &projection = child.Cast<PhysicalProjection>();
+	auto &scan = child.children[0]->Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" || (scan.table_filters && !scan.table_filters->filters.empty())) {
+		return;
+	}
+	auto &table = scan.bind_data->Cast<TableScanBindData>().table;
+	vector<column_t> columns;
+	for (auto &expr : op.aggregates) {
+		auto &aggregate = expr->Cast<BoundAggregateExpression>();
+		if (aggregate.function.name != "approx_count_distinct" || aggregate.IsDistinct() || aggregate.filter ||
+		    aggregate.bind_info) {
+			return;
+		}
+		D_ASSERT(aggregate.children.size() == 1);
+		// the input has to be a column of the table without any cast, otherwise the hashes differ
+		auto &input = projection.select_list[aggregate.children[0]->Cast<BoundReferenceExpression>().index];
+		if (input->type != ExpressionType::BOUND_REF) {
+			return;
+		}
+		auto scan_idx = input->Cast<BoundReferenceExpression>().index;
+		auto column_id = scan.column_ids[scan.projection_ids.empty() ? scan_idx : scan.projection_ids[scan_idx]];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			return;
+		}
+		auto &column = table.GetColumn(LogicalIndex(column_id));
+		if (column.Generated()) {
+			return;
+		}
+		columns.push_back(column.StorageOid());
+	}
+	op.sketch_table = &table.GetStorage();
+	op.sketch_columns = std::move(columns);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	// if the input is ordered on the groups, we can aggregate one group at a time
+	auto use_streaming_aggregate = CanUseStreamingAggregate(op);
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
@@ -170,8 +317,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 			}
 		}
 		if (use_simple_aggregation) {
-			groupby = make_uniq_base<PhysicalOperator, PhysicalUngroupedAggregate>(op.types, std::move(op.expressions),
-			                                                                       op.estimated_cardinality);
+			auto ungrouped_aggregate =
+			    make_uniq<PhysicalUngroupedAggregate>(op.types, std::move(op.expressions), op.estimated_cardinality);
+			InitializeSketchTable(*ungrouped_aggregate, *plan);
+			groupby = std::move(ungrouped_aggregate);
 		} else {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalHashAggregate>(
 			    context, op.types, std::move(op.expressions), op.estimated_cardinality);
@@ -184,6 +333,9 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
+		} else if (use_streaming_aggregate) {
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
 		} else {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.grouping_sets),
@@ -124,6 +124,11 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+
+	//! If a full HT holds more groups than this fraction of the rows that went into it, we skip the lookups
+	static constexpr const double SKIP_LOOKUP_THRESHOLD = 0.95;
+	//! After skipping the lookups for this many full HTs, we measure the reduction again
+	static constexpr const idx_t SKIP_LOOKUP_FILLS = 8;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -287,9 +292,15 @@ public:
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
+
+	//! Number of rows that went into the HT since it was last reset
+	idx_t sink_count;
+	//! Number of times the HT was full since we started skipping lookups
+	idx_t skipped_fills;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0), skipped_fills(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -371,6 +382,23 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 	return true;
 }
 
+void DecideSkipLookups(RadixHTLocalSinkState &lstate, const idx_t group_count) {
+	auto &ht = *lstate.ht;
+	D_ASSERT(ht.Count() == 0);
+	if (ht.SkipLookups()) {
+		// Do lookups again every now and then, the reduction may have changed
+		if (++lstate.skipped_fills >= RadixHTConfig::SKIP_LOOKUP_FILLS) {
+			ht.SetSkipLookups(false);
+		}
+	} else if (double(group_count) > RadixHTConfig::SKIP_LOOKUP_THRESHOLD * double(lstate.sink_count)) {
+		// The HT barely reduced the rows (near-unique groups), so the lookups are not worth it:
+		// append the rows to the partitions directly, they are combined during the Finalize anyway
+		ht.SetSkipLookups(true);
+		lstate.skipped_fills = 0;
+	}
+	lstate.sink_count = 0;
+}
+
 void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
                                      DataChunk &payload_input, const unsafe_vector<idx_t> &filter) const {
 	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
@@ -385,6 +413,7 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 
 	auto &ht = *lstate.ht;
 	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += group_chunk.size();
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
@@ -393,8 +422,13 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	if (gstate.active_threads > 2) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
-		ht.ClearPointerTable();
+		const auto group_count = ht.Count();
+		if (!ht.SkipLookups()) {
+			ht.ClearPointerTable();
+		}
 		ht.ResetCount();
+		// Decide whether the next rows should be looked up based on how much this HT reduced the rows
+		DecideSkipLookups(lstate, group_count);
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
 	}
 
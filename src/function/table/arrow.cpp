@@ -52,6 +52,8 @@ unique_ptr<ArrowType> ArrowTableFunction::GetArrowLogicalType(ArrowSchema &schem
 		return make_uniq<ArrowType>(LogicalType::VARCHAR, ArrowVariableSizeType::NORMAL);
 	} else if (format == "U") {
 		return make_uniq<ArrowType>(LogicalType::VARCHAR, ArrowVariableSizeType::SUPER_SIZE);
+	} else if (format == "vu") {
+		return make_uniq<ArrowType>(LogicalType::VARCHAR, ArrowVariableSizeType::VIEW);
 	} else if (format == "tsn:") {
 		return make_uniq<ArrowType>(LogicalTypeId::TIMESTAMP_NS);
 	} else if (format == "tsu:") {
@@ -161,6 +163,8 @@ unique_ptr<ArrowType> ArrowTableFunction::GetArrowLogicalType(ArrowSchema &schem
 		return make_uniq<ArrowType>(LogicalType::BLOB, ArrowVariableSizeType::NORMAL);
 	} else if (format == "Z") {
 		return make_uniq<ArrowType>(LogicalType::BLOB, ArrowVariableSizeType::SUPER_SIZE);
+	} else if (format == "vz") {
+		return make_uniq<ArrowType>(LogicalType::BLOB, ArrowVariableSizeType::VIEW);
 	} else if (format[0] == 'w') {
 		std::string parameters = format.substr(format.find(':') + 1);
 		idx_t fixed_size = std::stoi(parameters);
@@ -255,8 +259,34 @@ unique_ptr<FunctionData> ArrowTableFunction::ArrowScanBind(ClientContext &contex
 	return std::move(res);
 }
 
-unique_ptr<ArrowArrayStreamWrapper> ProduceArrowScan(const ArrowScanFunctionData &function,
-                                                     const vector<column_t> &column_ids, TableFilterSet *filters) {
+unique_ptr<FunctionData> ArrowTableFunction::ArrowScanPartitionedBind(ClientContext &context,
+                                                                      TableFunctionBindInput &input,
+                                                                      vector<LogicalType> &return_types,
+                                                                      vector<string> &names) {
+	for (auto &input_value : input.inputs) {
+		if (input_value.IsNull()) {
+			throw BinderException("arrow_scan_partitioned: pointers cannot be null");
+		}
+	}
+
+	auto stream_factory_ptr = input.inputs[0].GetPointer();
+	auto partition_produce = (stream_factory_produce_partition_t)input.inputs[1].GetPointer();     // NOLINT
+	auto stream_factory_get_schema = (stream_factory_get_schema_t)input.inputs[2].GetPointer();    // NOLINT
+	auto get_partition_count = (stream_factory_get_partition_count_t)input.inputs[3].GetPointer(); // NOLINT
+
+	auto res = make_uniq<ArrowScanFunctionData>(partition_produce, get_partition_count(stream_factory_ptr),
+	                                            stream_factory_ptr);
+
+	auto &data = *res;
+	stream_factory_get_schema(stream_factory_ptr, data.schema_root);
+	PopulateArrowTableType(res->arrow_table, data.schema_root, names, return_types);
+	RenameArrowColumns(names);
+	res->all_types = return_types;
+	return std::move(res);
+}
+
+static ArrowStreamParameters GetArrowStreamParameters(const ArrowScanFunctionData &function,
+                                                      const vector<column_t> &column_ids, TableFilterSet *filters) {
 	//! Generate Projection Pushdown Vector
 	ArrowStreamParameters parameters;
 	D_ASSERT(!column_ids.empty());
@@ -269,15 +299,65 @@ unique_ptr<ArrowArrayStreamWrapper> ProduceArrowScan(const ArrowScanFunctionData
 		}
 	}
 	parameters.filters = filters;
+	return parameters;
+}
+
+unique_ptr<ArrowArrayStreamWrapper> ProduceArrowScan(const ArrowScanFunctionData &function,
+                                                     const vector<column_t> &column_ids, TableFilterSet *filters) {
+	auto parameters = GetArrowStreamParameters(function, column_ids, filters);
 	return function.scanner_producer(function.stream_factory_ptr, parameters);
 }
 
 idx_t ArrowTableFunction::ArrowScanMaxThreads(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = bind_data_p->Cast<ArrowScanFunctionData>();
+	if (bind_data.partition_producer) {
+		return MaxValue<idx_t>(MinValue<idx_t>(context.db->NumberOfThreads(), bind_data.partition_count), 1);
+	}
 	return context.db->NumberOfThreads();
 }
 
+bool ArrowTableFunction::ArrowScanPartitionNext(const ArrowScanFunctionData &bind_data, ArrowScanLocalState &state,
+                                                ArrowScanGlobalState &parallel_state) {
+	while (true) {
+		if (state.stream) {
+			auto current_chunk = state.stream->GetNextChunk();
+			while (current_chunk->arrow_array.length == 0 && current_chunk->arrow_array.release) {
+				current_chunk = state.stream->GetNextChunk();
+			}
+			if (current_chunk->arrow_array.release) {
+				state.chunk = std::move(current_chunk);
+				state.chunk_offset = 0;
+				// the partitions are claimed in order, so these batch indexes preserve the order of the partitions
+				// arrays beyond the maximum share the last batch index: they are scanned by the same thread anyway
+				auto partition_batch =
+				    MinValue<idx_t>(state.partition_batch++, ArrowScanGlobalState::MAX_BATCHES_PER_PARTITION - 1);
+				state.batch_index =
+				    state.partition_idx * ArrowScanGlobalState::MAX_BATCHES_PER_PARTITION + partition_batch;
+				return true;
+			}
+			// this partition is exhausted
+			state.stream.reset();
+		}
+		{
+			lock_guard<mutex> parallel_lock(parallel_state.main_mutex);
+			if (parallel_state.next_partition >= bind_data.partition_count) {
+				return false;
+			}
+			state.partition_idx = parallel_state.next_partition++;
+		}
+		// produce the stream of the next partition outside of the lock, so partitions are opened in parallel
+		state.partition_batch = 0;
+		auto parameters = GetArrowStreamParameters(bind_data, state.column_ids, state.filters);
+		state.stream = bind_data.partition_producer(bind_data.stream_factory_ptr, parameters, state.partition_idx);
+	}
+}
+
 bool ArrowTableFunction::ArrowScanParallelStateNext(ClientContext &context, const FunctionData *bind_data_p,
                                                     ArrowScanLocalState &state, ArrowScanGlobalState &parallel_state) {
+	auto &bind_data = bind_data_p->Cast<ArrowScanFunctionData>();
+	if (bind_data.partition_producer) {
+		return ArrowScanPartitionNext(bind_data, state, parallel_state);
+	}
 	lock_guard<mutex> parallel_lock(parallel_state.main_mutex);
 	if (parallel_state.done) {
 		return false;
@@ -302,7 +382,10 @@ unique_ptr<GlobalTableFunctionState> ArrowTableFunction::ArrowScanInitGlobal(Cli
                                                                              TableFunctionInitInput &input) {
 	auto &bind_data = input.bind_data->Cast<ArrowScanFunctionData>();
 	auto result = make_uniq<ArrowScanGlobalState>();
-	result->stream = ProduceArrowScan(bind_data, input.column_ids, input.filters.get());
+	if (!bind_data.partition_producer) {
+		// partitioned scans produce a stream per partition in the local states instead
+		result->stream = ProduceArrowScan(bind_data, input.column_ids, input.filters.get());
+	}
 	result->max_threads = ArrowScanMaxThreads(context, input.bind_data.get());
 	if (input.CanRemoveFilterColumns()) {
 		result->projection_ids = input.projection_ids;
@@ -400,6 +483,18 @@ void ArrowTableFunction::RegisterFunction(BuiltinFunctions &set) {
 	arrow_dumb.filter_pushdown = false;
 	arrow_dumb.filter_prune = false;
 	set.AddFunction(arrow_dumb);
+
+	TableFunction arrow_partitioned("arrow_scan_partitioned",
+	                                {LogicalType::POINTER, LogicalType::POINTER, LogicalType::POINTER,
+	                                 LogicalType::POINTER},
+	                                ArrowScanFunction, ArrowScanPartitionedBind, ArrowScanInitGlobal,
+	                                ArrowScanInitLocal);
+	arrow_partitioned.cardinality = ArrowScanCardinality;
+	arrow_partitioned.get_batch_index = ArrowGetBatchIndex;
+	arrow_partitioned.projection_pushdown = true;
+	arrow_partitioned.filter_pushdown = true;
+	arrow_partitioned.filter_prune = true;
+	set.AddFunction(arrow_partitioned);
 }
 
 void BuiltinFunctions::RegisterArrowFunctions() {
@@ -3,6 +3,7 @@
 #include "duckdb/common/operator/multiply.hpp"
 #include "duckdb/common/types/hugeint.hpp"
 #include "duckdb/common/types/arrow_aux_data.hpp"
+#include "duckdb/common/types/arrow_string_view_type.hpp"
 #include "duckdb/function/scalar/nested_functions.hpp"
 
 namespace duckdb {
@@ -159,6 +160,26 @@ static void ArrowToDuckDBList(Vector &vector, ArrowArray &array, ArrowScanLocalS
 	}
 }
 
+//! Short strings are copied out of the view, long strings reference the data buffers of the Arrow array
+static void SetVectorStringView(Vector &vector, idx_t size, ArrowArray &array, idx_t offset) {
+	auto strings = FlatVector::GetData<string_t>(vector);
+	auto views = ArrowBufferData<arrow_string_view_t>(array, 1) + offset;
+	for (idx_t row_idx = 0; row_idx < size; row_idx++) {
+		if (FlatVector::IsNull(vector, row_idx)) {
+			continue;
+		}
+		auto &view = views[row_idx];
+		auto str_len = view.Length();
+		if (view.IsInlined()) {
+			strings[row_idx] = string_t(view.value.inlined.data, str_len);
+		} else {
+			// the data buffers follow the validity and view buffers
+			auto cdata = ArrowBufferData<char>(array, 2 + view.value.ref.buffer_index);
+			strings[row_idx] = string_t(cdata + view.value.ref.offset, str_len);
+		}
+	}
+}
+
 static void ArrowToDuckDBBlob(Vector &vector, ArrowArray &array, ArrowScanLocalState &scan_state, idx_t size,
                               const ArrowType &arrow_type, int64_t nested_offset) {
 	auto size_type = arrow_type.GetSizeType();
@@ -180,6 +201,12 @@ static void ArrowToDuckDBBlob(Vector &vector, ArrowArray &array, ArrowScanLocalS
 			FlatVector::GetData<string_t>(vector)[row_idx] = StringVector::AddStringOrBlob(vector, bptr, blob_len);
 			offset += blob_len;
 		}
+	} else if (size_type == ArrowVariableSizeType::VIEW) {
+		auto offset = array.offset + scan_state.chunk_offset;
+		if (nested_offset != -1) {
+			offset = array.offset + nested_offset;
+		}
+		SetVectorStringView(vector, size, array, offset);
 	} else if (size_type == ArrowVariableSizeType::NORMAL) {
 		auto offsets = ArrowBufferData<uint32_t>(array, 1) + array.offset + scan_state.chunk_offset;
 		if (nested_offset != -1) {
@@ -398,6 +425,14 @@ static void ColumnArrowToDuckDB(Vector &vector, ArrowArray &array, ArrowScanLoca
 	}
 	case LogicalTypeId::VARCHAR: {
 		auto size_type = arrow_type.GetSizeType();
+		if (size_type == ArrowVariableSizeType::VIEW) {
+			auto offset = array.offset + scan_state.chunk_offset;
+			if (nested_offset != -1) {
+				offset = array.offset + nested_offset;
+			}
+			SetVectorStringView(vector, size, array, offset);
+			break;
+		}
 		auto cdata = ArrowBufferData<char>(array, 2);
 		if (size_type == ArrowVariableSizeType::SUPER_SIZE) {
 			auto offsets = ArrowBufferData<uint64_t>(array, 1) + array.offset + scan_state.chunk_offset;
@@ -18,6 +18,9 @@
 #include "duckdb/main/extension_helper.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/storage/object_cache.hpp"
 
 #include <limits>
 
@@ -85,6 +88,82 @@ void ReadCSVData::FinalizeRead(ClientContext &context) {
 	}
 }
 
+//! Caches the result of sniffing a file, so repeated scans of an unchanged file can skip the sniffer
+class CSVSnifferCacheEntry : public ObjectCacheEntry {
+public:
+	CSVSnifferCacheEntry(const CSVReaderOptions &options, SnifferResult result_p, idx_t file_size_p,
+	                     time_t last_modified_p)
+	    : dialect_options(options.dialect_options), has_header(options.has_header),
+	      skip_rows_set(options.skip_rows_set), result(std::move(result_p)), file_size(file_size_p),
+	      last_modified(last_modified_p), read_time(time(nullptr)) {
+	}
+
+	//! The dialect and header detected by the sniffer
+	DialectOptions dialect_options;
+	bool has_header;
+	bool skip_rows_set;
+	//! The detected types and names
+	SnifferResult result;
+	//! Properties of the file when it was sniffed
+	idx_t file_size;
+	time_t last_modified;
+	time_t read_time;
+
+public:
+	//! Whether the file can not have changed since it was sniffed
+	bool IsValid(idx_t file_size_p, time_t last_modified_p) const {
+		// files modified around the time they were sniffed might have changed without a new modification time
+		return file_size == file_size_p && last_modified == last_modified_p && last_modified + 10 < read_time;
+	}
+
+	//! Sets the sniffed options in the options of a scan (see CSVSniffer::SetResultOptions), leaving the others as is
+	void SetResultOptions(CSVReaderOptions &options) const {
+		options.dialect_options = dialect_options;
+		options.has_header = has_header;
+		options.skip_rows_set = skip_rows_set;
+	}
+
+	static string ObjectType() {
+		return "csv_sniffer_result";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+};
+
+//! The sniffer result depends on the file and on all options that were passed in, so the key includes both
+static string CSVSnifferCacheKey(const CSVReaderOptions &options, const vector<LogicalType> &types,
+                                 const vector<string> &names) {
+	MemoryStream stream;
+	BinarySerializer::Serialize(options, stream, true);
+	string key = "csv_sniffer:" + options.file_path + ":";
+	key += string(const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+	for (idx_t i = 0; i < types.size(); i++) {
+		key += ":" + types[i].ToString();
+	}
+	for (idx_t i = 0; i < names.size(); i++) {
+		key += ":" + names[i];
+	}
+	// options that influence the sniffer or the scan, but are not serialized
+	for (auto &name : options.name_list) {
+		key += ":name=" + name;
+	}
+	for (auto &type : options.sql_type_list) {
+		key += ":type=" + type.ToString();
+	}
+	for (auto &entry : options.sql_types_per_column) {
+		key += ":column_type=" + entry.first + "=" + to_string(entry.second);
+	}
+	for (auto &type : options.auto_type_candidates) {
+		key += ":candidate=" + type.ToString();
+	}
+	key += ":has_newline=" + to_string(options.has_newline);
+	key += ":parallel_mode=" + to_string(static_cast<uint8_t>(options.parallel_mode));
+	key += ":explicitly_set_columns=" + to_string(options.explicitly_set_columns);
+	return key;
+}
+
 static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, TableFunctionBindInput &input,
                                             vector<LogicalType> &return_types, vector<string> &names) {
 
@@ -104,11 +183,35 @@ static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, TableFunctio
 	}
 	if (options.auto_detect) {
 		options.file_path = result->files[0];
-		// Initialize Buffer Manager and Sniffer
-		auto file_handle = BaseCSVReader::OpenCSV(context, options);
-		result->buffer_manager = make_shared<CSVBufferManager>(context, std::move(file_handle), options);
-		CSVSniffer sniffer(options, result->buffer_manager, result->state_machine_cache, explicitly_set_columns);
-		auto sniffer_result = sniffer.SniffCSV();
+		shared_ptr<CSVSnifferCacheEntry> cache_entry;
+		string cache_key;
+		idx_t file_size = 0;
+		time_t last_modified = 0;
+		if (ObjectCache::ObjectCacheEnabled(context)) {
+			auto &fs = FileSystem::GetFileSystem(context);
+			auto raw_handle = fs.OpenFile(options.file_path, FileFlags::FILE_FLAGS_READ);
+			file_size = raw_handle->GetFileSize();
+			last_modified = fs.GetLastModifiedTime(*raw_handle);
+			cache_key = CSVSnifferCacheKey(options, return_types, names);
+			cache_entry = ObjectCache::GetObjectCache(context).Get<CSVSnifferCacheEntry>(cache_key);
+			if (cache_entry && !cache_entry->IsValid(file_size, last_modified)) {
+				cache_entry.reset();
+			}
+		}
+		auto sniffer_result = cache_entry ? cache_entry->result : SnifferResult({}, {});
+		if (cache_entry) {
+			cache_entry->SetResultOptions(options);
+		} else {
+			// Initialize Buffer Manager and Sniffer
+			auto file_handle = BaseCSVReader::OpenCSV(context, options);
+			result->buffer_manager = make_shared<CSVBufferManager>(context, std::move(file_handle), options);
+			CSVSniffer sniffer(options, result->buffer_manager, result->state_machine_cache, explicitly_set_columns);
+			sniffer_result = sniffer.SniffCSV();
+			if (!cache_key.empty()) {
+				ObjectCache::GetObjectCache(context).Put(
+				    cache_key, make_shared<CSVSnifferCacheEntry>(options, sniffer_result, file_size, last_modified));
+			}
+		}
 		if (names.empty()) {
 			names = sniffer_result.names;
 			return_types = sniffer_result.return_types;
@@ -2315,6 +2315,22 @@ If the append is successful, DuckDBSuccess is returned.
 */
 DUCKDB_API duckdb_state duckdb_append_data_chunk(duckdb_appender appender, duckdb_data_chunk chunk);
 
+/*!
+Appends an Arrow array to the specified appender.
+
+The array must be a struct array (i.e. a record batch) with one child array per column of the table, described by the
+given Arrow schema. The columns are converted directly from the Arrow buffers, and cast to the table types if they
+differ. The schema and array are not released: they remain owned by the caller.
+If the schema does not match the table or the appender is in an invalid state, DuckDBError is returned.
+
+* appender: The appender to append to.
+* arrow_schema: The schema of the array.
+* arrow_array: The array to append.
+* returns: The return state.
+*/
+DUCKDB_API duckdb_state duckdb_append_arrow_array(duckdb_appender appender, duckdb_arrow_schema arrow_schema,
+                                                  duckdb_arrow_array arrow_array);
+
 //===--------------------------------------------------------------------===//
 // Arrow Interface
 //===--------------------------------------------------------------------===//
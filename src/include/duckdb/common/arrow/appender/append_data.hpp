@@ -46,7 +46,9 @@ struct ArrowAppendData {
 
 	// the arrow array C API data, only set after Finalize
 	unique_ptr<ArrowArray> array;
-	duckdb::array<const void *, 3> buffers = {{nullptr, nullptr, nullptr}};
+	duckdb::array<const void *, 4> buffers = {{nullptr, nullptr, nullptr, nullptr}};
+	//! The sizes of the data buffers of string views
+	duckdb::array<int64_t, 1> variadic_buffer_sizes = {{0}};
 	vector<ArrowArray *> child_pointers;
 
 	ClientProperties options;
@@ -53,7 +53,12 @@ struct ArrowEnumData : public ArrowScalarBaseData<TGT> {
 	static void Initialize(ArrowAppendData &result, const LogicalType &type, idx_t capacity) {
 		result.main_buffer.reserve(capacity * sizeof(TGT));
 		// construct the enum child data
-		auto enum_data = ArrowAppender::InitializeChild(LogicalType::VARCHAR, EnumType::GetSize(type), result.options);
+		// the dictionary is always exported as a regular string array ("u"), also when string views are produced
+		auto dictionary_options = result.options;
+		dictionary_options.produce_arrow_string_view = false;
+		dictionary_options.arrow_offset_size = ArrowOffsetSize::REGULAR;
+		auto enum_data =
+		    ArrowAppender::InitializeChild(LogicalType::VARCHAR, EnumType::GetSize(type), dictionary_options);
 		EnumAppendVector(*enum_data, EnumType::GetValuesInsertOrder(type), EnumType::GetSize(type));
 		result.child_data.push_back(std::move(enum_data));
 	}
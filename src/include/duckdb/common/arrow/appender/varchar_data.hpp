@@ -2,6 +2,7 @@
 
 #include "duckdb/common/arrow/appender/append_data.hpp"
 #include "duckdb/common/arrow/appender/scalar_data.hpp"
+#include "duckdb/common/types/arrow_string_view_type.hpp"
 
 namespace duckdb {
 
@@ -102,4 +103,73 @@ struct ArrowVarcharData {
 	}
 };
 
+//===--------------------------------------------------------------------===//
+// Varchar to Utf8View/BinaryView
+//===--------------------------------------------------------------------===//
+// String views have the same layout as string_t: short strings are inlined into the view, so only the strings that
+// are longer than 12 bytes are written to the (single) data buffer
+struct ArrowVarcharToStringViewData {
+	static void Initialize(ArrowAppendData &result, const LogicalType &type, idx_t capacity) {
+		result.main_buffer.reserve(capacity * sizeof(arrow_string_view_t));
+		result.aux_buffer.reserve(capacity);
+	}
+
+	static void Append(ArrowAppendData &append_data, Vector &input, idx_t from, idx_t to, idx_t input_size) {
+		idx_t size = to - from;
+		UnifiedVectorFormat format;
+		input.ToUnifiedFormat(input_size, format);
+
+		// resize the validity mask and set up the validity buffer for iteration
+		ResizeValidity(append_data.validity, append_data.row_count + size);
+		auto validity_data = (uint8_t *)append_data.validity.data();
+
+		// resize the view buffer, every row has a view
+		append_data.main_buffer.resize(append_data.main_buffer.size() + sizeof(arrow_string_view_t) * size);
+		auto data = UnifiedVectorFormat::GetData<string_t>(format);
+		auto views = append_data.main_buffer.GetData<arrow_string_view_t>() + append_data.row_count;
+		for (idx_t i = from; i < to; i++) {
+			auto source_idx = format.sel->get_index(i);
+			auto result_idx = i - from;
+
+			if (!format.validity.RowIsValid(source_idx)) {
+				uint8_t current_bit;
+				idx_t current_byte;
+				GetBitPosition(append_data.row_count + result_idx, current_byte, current_bit);
+				SetNull(append_data, validity_data, current_byte, current_bit);
+				views[result_idx] = arrow_string_view_t(0, nullptr);
+				continue;
+			}
+
+			auto &str = data[source_idx];
+			auto string_length = str.GetSize();
+			if (string_length <= arrow_string_view_t::MAX_INLINED_BYTES) {
+				views[result_idx] = arrow_string_view_t(int32_t(string_length), str.GetData());
+				continue;
+			}
+
+			// long strings are written to the data buffer, which is addressed with 32-bit offsets
+			auto current_offset = append_data.aux_buffer.size();
+			if (current_offset + string_length > idx_t(NumericLimits<int32_t>::Maximum())) {
+				throw InvalidInputException("Arrow Appender: The maximum total string size for string view buffers is "
+				                            "%d but the offset of %lu exceeds this.",
+				                            NumericLimits<int32_t>::Maximum(), current_offset + string_length);
+			}
+			append_data.aux_buffer.resize(current_offset + string_length);
+			memcpy(append_data.aux_buffer.data() + current_offset, str.GetData(), string_length);
+			views[result_idx] =
+			    arrow_string_view_t(int32_t(string_length), str.GetData(), 0, int32_t(current_offset));
+		}
+		append_data.row_count += size;
+	}
+
+	static void Finalize(ArrowAppendData &append_data, const LogicalType &type, ArrowArray *result) {
+		// validity, views, one data buffer and the sizes of the data buffers
+		result->n_buffers = 4;
+		result->buffers[1] = append_data.main_buffer.data();
+		result->buffers[2] = append_data.aux_buffer.data();
+		append_data.variadic_buffer_sizes[0] = int64_t(append_data.aux_buffer.size());
+		result->buffers[3] = append_data.variadic_buffer_sizes.data();
+	}
+};
+
 } // namespace duckdb
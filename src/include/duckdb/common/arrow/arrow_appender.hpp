@@ -25,6 +25,10 @@ public:
 	DUCKDB_API void Append(DataChunk &input, idx_t from, idx_t to, idx_t input_size);
 	//! Returns the underlying arrow array
 	DUCKDB_API ArrowArray Finalize();
+	//! Returns the amount of rows that have been appended so far
+	idx_t RowCount() const {
+		return row_count;
+	}
 
 public:
 	static void ReleaseArray(ArrowArray *array);
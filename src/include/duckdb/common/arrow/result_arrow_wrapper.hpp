@@ -25,6 +25,8 @@ public:
 	vector<LogicalType> column_types;
 	vector<string> column_names;
 	unique_ptr<ChunkScanState> scan_state;
+	//! The next array to emit, if the result already consists of arrow arrays
+	idx_t array_index = 0;
 
 private:
 	static int MyStreamGetSchema(struct ArrowArrayStream *stream, struct ArrowSchema *out);
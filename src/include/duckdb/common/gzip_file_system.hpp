@@ -12,6 +12,16 @@
 
 namespace duckdb {
 
+//! A single member of a BGZF file, which can be decompressed independently of the other members
+struct GZipBlock {
+	//! Offset and size of the member (header, deflate data and footer) within the compressed file
+	idx_t compressed_offset;
+	idx_t compressed_size;
+	//! Offset and size of the decompressed data of the member
+	idx_t uncompressed_offset;
+	idx_t uncompressed_size;
+};
+
 class GZipFileSystem : public CompressedFileSystem {
 	// 32 KB
 	static constexpr const idx_t BUFFER_SIZE = 1u << 15;
@@ -27,6 +37,13 @@ public:
 	static void VerifyGZIPHeader(uint8_t gzip_hdr[], idx_t read_count);
 	//! Consumes a byte stream as a gzip string, returning the decompressed string
 	static string UncompressGZIPString(const string &in);
+	//! Builds an index of the members of a BGZF file (a multi-member gzip file in which every member stores its
+	//! compressed size in the extra field), reading only the member headers and footers.
+	//! Returns false if the file is not a BGZF file.
+	static bool TryIndexBlocks(FileHandle &handle, vector<GZipBlock> &blocks);
+	//! Decompresses a single member of an indexed file
+	//! "compressed" holds the block.compressed_size bytes of the member, "out" receives block.uncompressed_size bytes
+	static void UncompressBlock(const GZipBlock &block, const_data_ptr_t compressed, data_ptr_t out);
 
 	unique_ptr<StreamWrapper> CreateStream() override;
 	idx_t InBufferSize() override;
@@ -47,6 +64,10 @@ static constexpr const uint8_t GZIP_HEADER_MINSIZE = 10;
 static constexpr const idx_t GZIP_HEADER_MAXSIZE = 1u << 15;
 static constexpr const uint8_t GZIP_FOOTER_SIZE = 8;
 
+//! BGZF members have a single 6-byte extra field: the "BC" subfield holding the member size minus one
+static constexpr const uint8_t BGZF_HEADER_SIZE = 18;
+static constexpr const uint8_t BGZF_EXTRA_SIZE = 6;
+
 static constexpr const unsigned char GZIP_FLAG_UNSUPPORTED =
     GZIP_FLAG_ASCII | GZIP_FLAG_MULTIPART | GZIP_FLAG_COMMENT | GZIP_FLAG_ENCRYPT;
 
@@ -56,8 +56,6 @@ private:
 
 	//! Unwizzles an offset into a pointer
 	static void UnswizzleSingleValue(data_ptr_t data_ptr, const data_ptr_t &heap_ptr, const LogicalType &type);
-	//! Swizzles a pointer into an offset
-	static void SwizzleSingleValue(data_ptr_t data_ptr, const data_ptr_t &heap_ptr, const LogicalType &type);
 };
 
 } // namespace duckdb
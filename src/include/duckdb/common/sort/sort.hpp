@@ -51,6 +51,27 @@ public:
 	unordered_map<idx_t, idx_t> sorting_to_blob_col;
 };
 
+//! The Merge Path partitioning of the merge of a pair of sorted blocks. Partition i holds the rows on diagonals
+//! [i * block_capacity, (i + 1) * block_capacity) of the merge, so every partition can find its own boundaries.
+struct MergePathState {
+	MergePathState() : partition_count(0), sliced_count(0), active_count(0), prefix_count(0), l_prefix(0), r_prefix(0) {
+	}
+
+	//! The number of partitions
+	idx_t partition_count;
+	//! The number of partitions of which the slices have been created
+	idx_t sliced_count;
+	//! The number of threads that are finding the boundaries of a partition, or creating its slices
+	idx_t active_count;
+	//! Whether or not the slices of a partition have been created, and the end of the partition in the left block
+	vector<bool> sliced;
+	vector<idx_t> l_ends;
+	//! The number of leading partitions that have been sliced, and where they end in the left and right block
+	idx_t prefix_count;
+	idx_t l_prefix;
+	idx_t r_prefix;
+};
+
 struct GlobalSortState {
 public:
 	GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders, RowLayout &payload_layout);
@@ -94,8 +115,8 @@ public:
 	//! Progress in merge path stage
 	idx_t pair_idx;
 	idx_t num_pairs;
-	idx_t l_start;
-	idx_t r_start;
+	idx_t partition_idx;
+	vector<MergePathState> merge_path_states;
 };
 
 struct LocalSortState {
@@ -170,10 +191,21 @@ private:
 	unique_ptr<SortedBlock> right_input;
 	SortedBlock *result;
 
+	//! The pair and partition that are merged
+	idx_t pair_idx;
+	idx_t partition_idx;
+	//! Known boundary of the merge, the rows before it are merged before any row of the partition
+	idx_t l_lower;
+	idx_t r_lower;
+
 private:
-	//! Computes the left and right block that will be merged next (Merge Path partition)
-	void GetNextPartition();
-	//! Finds the boundary of the next partition using binary search
+	//! Claims the next partition to merge, returns false if there are no partitions left in this round
+	bool ClaimNextPartition();
+	//! Computes the left and right slices of the claimed partition (Merge Path partition)
+	void GetPartition();
+	//! Marks the claimed partition as sliced, and releases the blocks that are no longer needed
+	void FinishPartition(idx_t l_end);
+	//! Finds the boundary of a partition using binary search
 	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
 	//! Compare values within SortedBlocks using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/arrow_string_view_type.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The 16-byte elements of Arrow's Utf8View and BinaryView arrays. Like string_t, strings of up to 12 bytes are
+//! inlined, longer strings store a 4-byte prefix together with the index of and the offset into a data buffer
+struct arrow_string_view_t {
+	static constexpr idx_t MAX_INLINED_BYTES = 12 * sizeof(char);
+	static constexpr idx_t PREFIX_BYTES = 4 * sizeof(char);
+
+	arrow_string_view_t() {
+	}
+
+	//! Constructs an inlined string view
+	arrow_string_view_t(int32_t length, const char *data) {
+		D_ASSERT(length <= int32_t(MAX_INLINED_BYTES));
+		value.inlined.length = length;
+		memset(value.inlined.data, 0, MAX_INLINED_BYTES);
+		if (length > 0) {
+			memcpy(value.inlined.data, data, length);
+		}
+	}
+
+	//! Constructs a string view that references a data buffer
+	arrow_string_view_t(int32_t length, const char *data, int32_t buffer_index, int32_t offset) {
+		D_ASSERT(length > int32_t(MAX_INLINED_BYTES));
+		value.ref.length = length;
+		memcpy(value.ref.prefix, data, PREFIX_BYTES);
+		value.ref.buffer_index = buffer_index;
+		value.ref.offset = offset;
+	}
+
+	int32_t Length() const {
+		return value.inlined.length;
+	}
+	bool IsInlined() const {
+		return value.inlined.length <= int32_t(MAX_INLINED_BYTES);
+	}
+
+	union {
+		struct {
+			int32_t length;
+			char data[MAX_INLINED_BYTES];
+		} inlined;
+		struct {
+			int32_t length;
+			char prefix[PREFIX_BYTES];
+			int32_t buffer_index;
+			int32_t offset;
+		} ref;
+	} value;
+};
+
+} // namespace duckdb
@@ -133,6 +133,9 @@ public:
 	void ResetCount();
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
+	//! Whether every row is appended as a new group, without looking up (or inserting into) the pointer table
+	bool SkipLookups() const;
+	void SetSkipLookups(bool skip_lookups);
 	//! Initializes the PartitionedTupleData
 	void InitializePartitionedData();
 
@@ -174,6 +177,8 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! Whether lookups are skipped, i.e., every row becomes a new group (see SetSkipLookups)
+	bool skip_lookups;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
@@ -201,6 +206,9 @@ private:
 	//! Does the actual group matching / creation
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
+	//! Appends every row as a new group, without touching the pointer table
+	idx_t CreateGroupsWithoutLookup(DataChunk &groups, Vector &group_hashes, Vector &addresses,
+	                                SelectionVector &new_groups);
 
 	//! Verify the pointer table of the HT
 	void Verify();
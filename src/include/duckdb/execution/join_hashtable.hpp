@@ -153,6 +153,11 @@ public:
 		return *data_collection;
 	}
 
+	//! The chunk index at which each radix partition ends in the data collection (empty if it was not unpartitioned)
+	const vector<idx_t> &GetPartitionChunkEnds() const {
+		return partition_chunk_ends;
+	}
+
 	//! BufferManager
 	BufferManager &buffer_manager;
 	//! The join conditions
@@ -186,6 +191,8 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! Right shift that is applied to the hashes before the bitmask (see InitializePointerTable)
+	idx_t hash_shift;
 
 	struct {
 		mutex mj_lock;
@@ -209,9 +216,8 @@ private:
 	                                                  const SelectionVector *&current_sel);
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
 
-	//! Apply a bitmask to the hashes
-	void ApplyBitmask(Vector &hashes, idx_t count);
-	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
+	//! Look up the heads of the row chains of the hashes in the pointer table (nullptr if there are none)
+	void GetRowPointers(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
 
 private:
 	//! Insert the given set of locations into the HT with the given set of hashes
@@ -226,7 +232,8 @@ private:
 	unique_ptr<PartitionedTupleData> sink_collection;
 	//! The DataCollection holding the main data of the hash table
 	unique_ptr<TupleDataCollection> data_collection;
-	//! The hash map of the HT, created after finalization
+	//! The hash map of the HT, created after finalization. This is a linear probing table of salted pointers, every
+	//! entry points to a chain of rows that have the same salt (the upper bits of the hash)
 	AllocatedData hash_map;
 	//! Whether or not NULL values are considered equal in each of the comparisons
 	vector<bool> null_values_are_equal;
@@ -306,7 +313,7 @@ public:
 	}
 	//! Size of the pointer table (in bytes)
 	static idx_t PointerTableSize(idx_t count) {
-		return PointerTableCapacity(count) * sizeof(data_ptr_t);
+		return PointerTableCapacity(count) * sizeof(aggr_ht_entry_t);
 	}
 
 	//! Whether we need to do an external join
@@ -329,6 +336,8 @@ private:
 	//! First and last partition of the current probe round
 	idx_t partition_start;
 	idx_t partition_end;
+	//! The chunk index at which each radix partition ends in the data collection
+	vector<idx_t> partition_chunk_ends;
 };
 
 } // namespace duckdb
@@ -19,6 +19,9 @@ struct DistinctAggregateCollectionInfo {
 public:
 	DistinctAggregateCollectionInfo(const vector<unique_ptr<Expression>> &aggregates, vector<idx_t> indices);
 
+	//! The maximum amount of different inputs that share a table (the tag is a UTINYINT)
+	static constexpr const idx_t MAX_TABLE_INPUTS = 256;
+
 public:
 	// The indices of the aggregates that are distinct
 	unsafe_vector<idx_t> indices;
@@ -28,6 +31,10 @@ public:
 	vector<idx_t> table_indices;
 	//! This indirection is used to allow two aggregates to share the same input data
 	unordered_map<idx_t, idx_t> table_map;
+	//! Aggregates with different inputs of the same types share a table, their input is distinguished by a tag
+	unordered_map<idx_t, idx_t> tag_map;
+	//! For every table, the aggregate whose input is added to the table (for every tag)
+	vector<vector<idx_t>> table_inputs;
 	const vector<unique_ptr<Expression>> &aggregates;
 	// Total amount of children of the distinct aggregates
 	idx_t total_child_count;
@@ -36,6 +43,8 @@ public:
 	static unique_ptr<DistinctAggregateCollectionInfo> Create(vector<unique_ptr<Expression>> &aggregates);
 	const unsafe_vector<idx_t> &Indices() const;
 	bool AnyDistinct() const;
+	//! Whether or not the table is shared by aggregates with different inputs
+	bool IsTagged(idx_t table_idx) const;
 
 private:
 	//! Returns the amount of tables that are occupied
@@ -53,10 +62,14 @@ public:
 	vector<unique_ptr<RadixPartitionedHashTable>> radix_tables;
 	//! The groups (arguments)
 	vector<GroupingSet> grouping_sets;
+	//! The types of the chunks that are added to the tagged tables (unreferenced columns are SQLNULL)
+	vector<vector<LogicalType>> table_input_types;
 	const DistinctAggregateCollectionInfo &info;
 
 public:
 	bool IsDistinct(idx_t index) const;
+	//! Populates the chunk that is added to a tagged table with the input of the aggregate and the tag of the input
+	void PopulateTableInput(idx_t aggr_idx, DataChunk &input, DataChunk &table_input) const;
 };
 
 struct DistinctAggregateState {
@@ -46,6 +46,8 @@ public:
 
 	//! Initialize a GroupedAggregateData object for use with distinct aggregates
 	void InitializeDistinct(const unique_ptr<Expression> &aggregate, const vector<unique_ptr<Expression>> *groups_p);
+	//! Add a (UTINYINT) tag group, which distinguishes distinct aggregates with different inputs that share the data
+	void InitializeDistinctTag(idx_t tag_index);
 
 private:
 	void InitializeDistinctGroups(const vector<unique_ptr<Expression>> *groups);
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+class StreamingAggregateState;
+
+//! PhysicalStreamingAggregate computes a grouped aggregate over input that is ordered on the groups. Rows of the same
+//! group are adjacent, so a group is finished (and emitted) as soon as the groups change, and only the aggregate state
+//! of the current group has to be kept between chunks.
+class PhysicalStreamingAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_GROUP_BY;
+
+public:
+	PhysicalStreamingAggregate(vector<LogicalType> types, vector<unique_ptr<Expression>> expressions,
+	                           vector<unique_ptr<Expression>> groups, idx_t estimated_cardinality);
+
+	//! The groups, these are references to the input columns
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed, their children are references to the input columns
+	vector<unique_ptr<Expression>> aggregates;
+	//! The input columns of the groups
+	vector<idx_t> group_columns;
+	//! The input columns and types of the aggregate inputs
+	vector<idx_t> payload_columns;
+	vector<LogicalType> payload_types;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const override;
+
+	//! The input has to be processed in order, by a single thread
+	bool ParallelOperator() const override {
+		return false;
+	}
+
+	//! The last group is emitted after all input has been processed
+	bool RequiresFinalExecute() const override {
+		return true;
+	}
+
+	OrderPreservationType OperatorOrder() const override {
+		return OrderPreservationType::FIXED_ORDER;
+	}
+
+	string ParamsToString() const override;
+
+private:
+	//! Finds the rows of the input that start a new group, returns the number of new groups
+	idx_t FindGroupStarts(DataChunk &input, StreamingAggregateState &state) const;
+};
+
+} // namespace duckdb
@@ -17,6 +17,7 @@
 #include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
+class DataTable;
 
 //! PhysicalUngroupedAggregate is an aggregate operator that can only perform aggregates (1) without any groups, (2)
 //! without any DISTINCT aggregates, and (3) when all aggregates are combineable
@@ -32,6 +33,10 @@ public:
 	vector<unique_ptr<Expression>> aggregates;
 	unique_ptr<DistinctAggregateData> distinct_data;
 	unique_ptr<DistinctAggregateCollectionInfo> distinct_collection_info;
+	//! If set, the aggregates are approx_count_distinct over entire columns of this table. They are answered from the
+	//! distinct statistics of these columns instead of scanning the table, if the statistics are exact.
+	optional_ptr<DataTable> sketch_table;
+	vector<column_t> sketch_columns;
 
 public:
 	// Source interface
@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/helper/physical_arrow_collector.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+
+namespace duckdb {
+
+//! The PhysicalArrowCollector converts the query result into Arrow arrays while it is being collected, using all
+//! threads that run the final pipeline. If the plan is order preserving the arrays are ordered by batch index.
+class PhysicalArrowCollector : public PhysicalResultCollector {
+public:
+	PhysicalArrowCollector(PreparedStatementData &data, bool parallel, bool use_batch_index, idx_t batch_size);
+
+	//! Whether or not the sink runs in parallel
+	bool parallel;
+	//! Whether or not the arrays are ordered by batch index
+	bool use_batch_index;
+	//! The (maximum) amount of rows per array
+	idx_t record_batch_size;
+
+public:
+	//! Creates an arrow collector for the plan, picking the same ordering strategy as the materialized collectors
+	static unique_ptr<PhysicalResultCollector> Create(ClientContext &context, PreparedStatementData &data,
+	                                                  idx_t batch_size);
+
+	unique_ptr<QueryResult> GetResult(GlobalSinkState &state) override;
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool RequiresBatchIndex() const override {
+		return use_batch_index;
+	}
+
+	bool IsSink() const override {
+		return true;
+	}
+
+	bool ParallelSink() const override {
+		return parallel;
+	}
+
+	bool SinkOrderDependent() const override {
+		return true;
+	}
+};
+
+} // namespace duckdb
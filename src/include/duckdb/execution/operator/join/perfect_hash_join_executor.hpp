@@ -20,10 +20,13 @@ class HashJoinGlobalSinkState;
 class PhysicalHashJoin;
 
 struct PerfectHashJoinStats {
-	Value build_min;
-	Value build_max;
-	Value probe_min;
-	Value probe_max;
+	//! The min/max of the keys of every join condition
+	vector<Value> build_min;
+	vector<Value> build_max;
+	vector<Value> probe_min;
+	vector<Value> probe_max;
+	//! The keys of multiple conditions are combined into a mixed-radix index: (key - min) * multiplier for every key
+	vector<idx_t> key_multipliers;
 	bool is_build_small = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
@@ -44,21 +47,17 @@ public:
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state);
-	bool BuildPerfectHashTable(LogicalType &type);
+	bool BuildPerfectHashTable();
 
 private:
-	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
-	                                    idx_t count, idx_t &probe_sel_count);
+	//! Adds the offset of the key of the given condition to the index of every selected row, and removes the rows with
+	//! a NULL key or a key outside of the build range from the selection. Returns the remaining selection count.
+	idx_t ComputeIndexSwitch(idx_t key_idx, Vector &source, idx_t count, SelectionVector &sel, idx_t sel_count,
+	                         idx_t indices[]);
 	template <typename T>
-	void TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
-
-	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                    idx_t count);
-	template <typename T>
-	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                       idx_t count);
-	bool FullScanHashTable(LogicalType &key_type);
+	idx_t TemplatedComputeIndex(idx_t key_idx, Vector &source, idx_t count, SelectionVector &sel, idx_t sel_count,
+	                            idx_t indices[]);
+	bool FullScanHashTable();
 
 private:
 	const PhysicalHashJoin &join;
@@ -49,6 +49,8 @@ public:
 	// Operator Interface
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
 
+	string ParamsToString() const override;
+
 	bool ParallelOperator() const override {
 		return true;
 	}
@@ -146,7 +146,7 @@ struct CSVReaderOptions {
 	//! If we are running the parallel version of the CSV Reader. In general, the system should always auto-detect
 	//! When it can't execute a parallel run before execution. However, there are (rather specific) situations where
 	//! setting up this manually might be important
-	ParallelMode parallel_mode;
+	ParallelMode parallel_mode = ParallelMode::AUTOMATIC;
 	//===--------------------------------------------------------------------===//
 	// WriteCSVOptions
 	//===--------------------------------------------------------------------===//
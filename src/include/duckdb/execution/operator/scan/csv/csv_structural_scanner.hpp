@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/scan/csv/csv_structural_scanner.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/helper.hpp"
+
+namespace duckdb {
+
+//! The CSVStructuralScanner searches a buffer for the next structural character (e.g., delimiter, quote, newline).
+//! Most bytes of a CSV file are plain field content, so instead of comparing every byte against every structural
+//! character, the scanner tests 8 bytes at a time (SWAR) and only inspects individual bytes in a block that contains
+//! a match. This is portable across architectures and lets the parsers skip over long runs of field content.
+class CSVStructuralScanner {
+public:
+	//! Scanner that stops at any of the three given characters
+	CSVStructuralScanner(char c1, char c2, char c3) {
+		characters[0] = c1;
+		characters[1] = c2;
+		characters[2] = c3;
+		for (idx_t i = 0; i < 3; i++) {
+			patterns[i] = LOW_BITS * static_cast<uint8_t>(characters[i]);
+		}
+	}
+
+	//! Scanner for unquoted values: stops at the delimiter or at any newline character
+	static CSVStructuralScanner Unquoted(char delimiter) {
+		return CSVStructuralScanner(delimiter, '\n', '\r');
+	}
+	//! Scanner for quoted values: stops at the quote or escape character
+	static CSVStructuralScanner Quoted(char quote, char escape) {
+		return CSVStructuralScanner(quote, escape, quote);
+	}
+
+	//! Returns the position of the first structural character in [pos, end), or end if there is none
+	inline idx_t Find(const char *buffer, idx_t pos, idx_t end) const {
+		for (; pos + sizeof(uint64_t) <= end; pos += sizeof(uint64_t)) {
+			auto block = Load<uint64_t>(const_data_ptr_cast(buffer + pos));
+			if (BlockHasMatch(block)) {
+				break;
+			}
+		}
+		for (; pos < end; pos++) {
+			if (IsStructural(buffer[pos])) {
+				return pos;
+			}
+		}
+		return end;
+	}
+
+	inline bool IsStructural(char c) const {
+		return c == characters[0] || c == characters[1] || c == characters[2];
+	}
+
+private:
+	static constexpr uint64_t LOW_BITS = 0x0101010101010101ULL;
+	static constexpr uint64_t HIGH_BITS = 0x8080808080808080ULL;
+
+	//! Whether any byte of the block is equal to a structural character
+	inline bool BlockHasMatch(uint64_t block) const {
+		return (HasZeroByte(block ^ patterns[0]) | HasZeroByte(block ^ patterns[1]) |
+		        HasZeroByte(block ^ patterns[2])) != 0;
+	}
+
+	//! Sets the high bit of (at least) every zero byte, is zero if and only if no byte of the block is zero
+	static inline uint64_t HasZeroByte(uint64_t block) {
+		return (block - LOW_BITS) & ~block & HIGH_BITS;
+	}
+
+	char characters[3];
+	//! The structural characters broadcast to every byte of a block
+	uint64_t patterns[3];
+};
+
+} // namespace duckdb
@@ -13,6 +13,7 @@
 #include "duckdb/execution/operator/scan/csv/csv_file_handle.hpp"
 #include "duckdb/execution/operator/scan/csv/csv_buffer.hpp"
 #include "duckdb/execution/operator/scan/csv/csv_line_info.hpp"
+#include "duckdb/execution/operator/scan/csv/csv_structural_scanner.hpp"
 
 #include <sstream>
 #include <utility>
@@ -48,6 +49,24 @@ struct CSVBufferRead {
 		return next_ptr[i - buffer->actual_size];
 	}
 
+	//! Returns the position of the first structural character in [position, end), or end if there is none
+	idx_t Find(const CSVStructuralScanner &scanner, idx_t position, idx_t end) const {
+		auto buffer_end = MinValue<idx_t>(end, buffer->actual_size);
+		if (position < buffer_end) {
+			position = scanner.Find(buffer->Ptr(), position, buffer_end);
+			if (position < buffer_end) {
+				return position;
+			}
+		}
+		if (position >= end) {
+			return end;
+		}
+		// continue the search in the next buffer
+		D_ASSERT(next_buffer);
+		auto offset = buffer->actual_size;
+		return scanner.Find(next_buffer->Ptr(), position - offset, end - offset) + offset;
+	}
+
 	string_t GetValue(idx_t start_buffer, idx_t position_buffer, idx_t offset) {
 		idx_t length = position_buffer - start_buffer - offset;
 		// 1) It's all in the current buffer
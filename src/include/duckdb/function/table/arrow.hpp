@@ -43,12 +43,23 @@ struct ArrowStreamParameters {
 typedef unique_ptr<ArrowArrayStreamWrapper> (*stream_factory_produce_t)(uintptr_t stream_factory_ptr,
                                                                         ArrowStreamParameters &parameters);
 typedef void (*stream_factory_get_schema_t)(uintptr_t stream_factory_ptr, ArrowSchemaWrapper &schema);
+//! Partitioned producers expose a fixed amount of independent partitions, which are scanned in parallel
+//! Note that the produce function of a partitioned producer is called concurrently from multiple threads
+typedef unique_ptr<ArrowArrayStreamWrapper> (*stream_factory_produce_partition_t)(uintptr_t stream_factory_ptr,
+                                                                                  ArrowStreamParameters &parameters,
+                                                                                  idx_t partition_idx);
+typedef idx_t (*stream_factory_get_partition_count_t)(uintptr_t stream_factory_ptr);
 
 struct ArrowScanFunctionData : public PyTableFunctionData {
 public:
 	ArrowScanFunctionData(stream_factory_produce_t scanner_producer_p, uintptr_t stream_factory_ptr_p)
 	    : lines_read(0), stream_factory_ptr(stream_factory_ptr_p), scanner_producer(scanner_producer_p) {
 	}
+	ArrowScanFunctionData(stream_factory_produce_partition_t partition_producer_p, idx_t partition_count_p,
+	                      uintptr_t stream_factory_ptr_p)
+	    : lines_read(0), stream_factory_ptr(stream_factory_ptr_p), scanner_producer(nullptr),
+	      partition_producer(partition_producer_p), partition_count(partition_count_p) {
+	}
 	vector<LogicalType> all_types;
 	atomic<idx_t> lines_read;
 	ArrowSchemaWrapper schema_root;
@@ -57,6 +68,10 @@ public:
 	uintptr_t stream_factory_ptr;
 	//! Pointer to the scanner factory produce
 	stream_factory_produce_t scanner_producer;
+	//! Pointer to the partition produce of a partitioned scanner factory (if any)
+	stream_factory_produce_partition_t partition_producer = nullptr;
+	//! The amount of partitions of a partitioned scanner factory
+	idx_t partition_count = 0;
 	//! Arrow table data
 	ArrowTableType arrow_table;
 };
@@ -65,7 +80,11 @@ struct ArrowScanLocalState : public LocalTableFunctionState {
 	explicit ArrowScanLocalState(unique_ptr<ArrowArrayWrapper> current_chunk) : chunk(current_chunk.release()) {
 	}
 
+	//! The stream of the partition that is being scanned (partitioned scans only)
 	unique_ptr<ArrowArrayStreamWrapper> stream;
+	//! The partition that is being scanned and the amount of arrays read from it (partitioned scans only)
+	idx_t partition_idx = 0;
+	idx_t partition_batch = 0;
 	shared_ptr<ArrowArrayWrapper> chunk;
 	// This vector hold the Arrow Vectors owned by DuckDB to allow for zero-copy
 	// Note that only DuckDB can release these vectors
@@ -81,11 +100,16 @@ struct ArrowScanLocalState : public LocalTableFunctionState {
 };
 
 struct ArrowScanGlobalState : public GlobalTableFunctionState {
+	//! The batch indexes of a partition start at partition_idx * MAX_BATCHES_PER_PARTITION
+	static constexpr const idx_t MAX_BATCHES_PER_PARTITION = 1000000;
+
 	unique_ptr<ArrowArrayStreamWrapper> stream;
 	mutex main_mutex;
 	idx_t max_threads = 1;
 	idx_t batch_index = 0;
 	bool done = false;
+	//! The next partition to scan (partitioned scans only)
+	idx_t next_partition = 0;
 
 	vector<idx_t> projection_ids;
 	vector<LogicalType> scanned_types;
@@ -107,6 +131,9 @@ public:
 	//! Binds an arrow table
 	static unique_ptr<FunctionData> ArrowScanBind(ClientContext &context, TableFunctionBindInput &input,
 	                                              vector<LogicalType> &return_types, vector<string> &names);
+	//! Binds a partitioned arrow producer
+	static unique_ptr<FunctionData> ArrowScanPartitionedBind(ClientContext &context, TableFunctionBindInput &input,
+	                                                         vector<LogicalType> &return_types, vector<string> &names);
 	//! Actual conversion from Arrow to DuckDB
 	static void ArrowToDuckDB(ArrowScanLocalState &scan_state, const arrow_column_map_t &arrow_convert_data,
 	                          DataChunk &output, idx_t start, bool arrow_scan_is_projected = true);
@@ -114,6 +141,9 @@ public:
 	//! Get next scan state
 	static bool ArrowScanParallelStateNext(ClientContext &context, const FunctionData *bind_data_p,
 	                                       ArrowScanLocalState &state, ArrowScanGlobalState &parallel_state);
+	//! Get next scan state of a partitioned scan
+	static bool ArrowScanPartitionNext(const ArrowScanFunctionData &bind_data, ArrowScanLocalState &state,
+	                                   ArrowScanGlobalState &parallel_state);
 
 	//! Initialize Global State
 	static unique_ptr<GlobalTableFunctionState> ArrowScanInitGlobal(ClientContext &context,
@@ -11,6 +11,7 @@
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/main/table_description.hpp"
+#include "duckdb/storage/storage_info.hpp"
 
 namespace duckdb {
 
@@ -29,7 +30,9 @@ enum class AppenderType : uint8_t {
 class BaseAppender {
 protected:
 	//! The amount of tuples that will be gathered in the column data collection before flushing
-	static constexpr const idx_t FLUSH_COUNT = STANDARD_VECTOR_SIZE * 100;
+	//! This is a multiple of the row group size, so that every flush produces complete row groups that can be
+	//! written to storage and merged into the table directly, instead of being re-appended at commit
+	static constexpr const idx_t FLUSH_COUNT = Storage::ROW_GROUP_SIZE * 2;
 
 	Allocator &allocator;
 	//! The append types
@@ -0,0 +1,54 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/arrow_query_result.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/arrow/arrow_wrapper.hpp"
+#include "duckdb/common/winapi.hpp"
+#include "duckdb/main/query_result.hpp"
+
+namespace duckdb {
+
+class ClientContext;
+
+//! The ArrowQueryResult holds a query result that has already been converted into Arrow record batches, in the order
+//! in which they are produced by the query
+class ArrowQueryResult : public QueryResult {
+public:
+	static constexpr const QueryResultType TYPE = QueryResultType::ARROW_RESULT;
+
+public:
+	friend class ClientContext;
+	//! Creates a successful query result with the specified names and types
+	DUCKDB_API ArrowQueryResult(StatementType statement_type, StatementProperties properties, vector<string> names_p,
+	                            vector<LogicalType> types_p, ClientProperties client_properties, idx_t batch_size);
+	//! Creates an unsuccessful query result with error condition
+	DUCKDB_API explicit ArrowQueryResult(PreservedError error);
+
+public:
+	//! Fetching DataChunks is not supported, the arrays have to be consumed with ConsumeArrays
+	DUCKDB_API unique_ptr<DataChunk> Fetch() override;
+	DUCKDB_API unique_ptr<DataChunk> FetchRaw() override;
+	//! Converts the QueryResult to a string
+	DUCKDB_API string ToString() override;
+
+	DUCKDB_API idx_t RowCount() const;
+	DUCKDB_API idx_t BatchSize() const;
+
+	//! Returns the arrays of the result and moves them out of the result
+	DUCKDB_API vector<unique_ptr<ArrowArrayWrapper>> ConsumeArrays();
+	DUCKDB_API vector<unique_ptr<ArrowArrayWrapper>> &Arrays();
+	DUCKDB_API void SetArrowData(vector<unique_ptr<ArrowArrayWrapper>> arrays);
+
+private:
+	vector<unique_ptr<ArrowArrayWrapper>> arrays;
+	//! The (maximum) amount of rows per array
+	idx_t batch_size;
+};
+
+} // namespace duckdb
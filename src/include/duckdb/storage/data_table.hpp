@@ -173,6 +173,9 @@ public:
 	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id);
 	//! Sets statistics of a physical column within the table
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	//! Get the HLL of a physical column within the table, if it holds exactly the values that are visible to the
+	//! transaction. Returns nullptr otherwise.
+	unique_ptr<HyperLogLog> GetDistinctSketch(DuckTransaction &transaction, column_t column_id);
 
 	//! Checkpoint the table to the specified table data writer
 	void Checkpoint(TableDataWriter &writer, Serializer &metadata_serializer);
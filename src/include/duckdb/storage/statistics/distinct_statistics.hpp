@@ -36,6 +36,12 @@ public:
 
 	void Update(Vector &update, idx_t count, bool sample = true);
 	void Update(UnifiedVectorFormat &update_data, const LogicalType &ptype, idx_t count, bool sample = true);
+	//! Counts values that overwrite existing values. The overwritten values cannot be removed from the HLL, so the new
+	//! values are not added to it either.
+	void UpdateOverwritten(idx_t count);
+
+	//! Whether or not the HLL holds every value that has been inserted, i.e. it was not sampled or overwritten
+	bool IsExact() const;
 
 	string ToString() const;
 	idx_t GetCount() const;
@@ -102,6 +102,8 @@ public:
 	void CopyStats(TableStatistics &stats);
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	//! Returns a copy of the HLL of a column if it holds exactly the values that are visible to the transaction
+	unique_ptr<HyperLogLog> GetDistinctSketch(TransactionData transaction, column_t column_id);
 
 	AttachedDatabase &GetAttached();
 	BlockManager &GetBlockManager() {
@@ -0,0 +1,67 @@
+#include "duckdb/main/arrow_query_result.hpp"
+#include "duckdb/common/to_string.hpp"
+
+namespace duckdb {
+
+ArrowQueryResult::ArrowQueryResult(StatementType statement_type, StatementProperties properties,
+                                   vector<string> names_p, vector<LogicalType> types_p,
+                                   ClientProperties client_properties, idx_t batch_size)
+    : QueryResult(QueryResultType::ARROW_RESULT, statement_type, std::move(properties), std::move(types_p),
+                  std::move(names_p), std::move(client_properties)),
+      batch_size(batch_size) {
+}
+
+ArrowQueryResult::ArrowQueryResult(PreservedError error)
+    : QueryResult(QueryResultType::ARROW_RESULT, std::move(error)), batch_size(0) {
+}
+
+unique_ptr<DataChunk> ArrowQueryResult::Fetch() {
+	throw NotImplementedException("Can't 'Fetch' from ArrowQueryResult");
+}
+
+unique_ptr<DataChunk> ArrowQueryResult::FetchRaw() {
+	throw NotImplementedException("Can't 'FetchRaw' from ArrowQueryResult");
+}
+
+string ArrowQueryResult::ToString() {
+	if (!success) {
+		return GetError() + "\n";
+	}
+	return HeaderToString() + "[ Rows: " + to_string(RowCount()) + " in " + to_string(arrays.size()) +
+	       " Arrow arrays]\n";
+}
+
+idx_t ArrowQueryResult::RowCount() const {
+	idx_t count = 0;
+	for (auto &array : arrays) {
+		count += idx_t(array->arrow_array.length);
+	}
+	return count;
+}
+
+idx_t ArrowQueryResult::BatchSize() const {
+	return batch_size;
+}
+
+vector<unique_ptr<ArrowArrayWrapper>> ArrowQueryResult::ConsumeArrays() {
+	if (HasError()) {
+		throw InvalidInputException("Attempting to fetch ArrowArrays from an unsuccessful query result\n: Error %s",
+		                            GetError());
+	}
+	return std::move(arrays);
+}
+
+vector<unique_ptr<ArrowArrayWrapper>> &ArrowQueryResult::Arrays() {
+	if (HasError()) {
+		throw InvalidInputException("Attempting to fetch ArrowArrays from an unsuccessful query result\n: Error %s",
+		                            GetError());
+	}
+	return arrays;
+}
+
+void ArrowQueryResult::SetArrowData(vector<unique_ptr<ArrowArrayWrapper>> arrays_p) {
+	D_ASSERT(arrays.empty());
+	arrays = std::move(arrays_p);
+}
+
+} // namespace duckdb
@@ -1,12 +1,17 @@
 #include "duckdb/main/capi/capi_internal.hpp"
+#include "duckdb/common/arrow/arrow_wrapper.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/function/table/arrow.hpp"
 
 using duckdb::Appender;
 using duckdb::AppenderWrapper;
 using duckdb::Connection;
+using duckdb::DataChunk;
 using duckdb::date_t;
 using duckdb::dtime_t;
 using duckdb::hugeint_t;
 using duckdb::interval_t;
+using duckdb::LogicalType;
 using duckdb::string_t;
 using duckdb::timestamp_t;
 
@@ -206,3 +211,71 @@ duckdb_state duckdb_append_data_chunk(duckdb_appender appender, duckdb_data_chun
 	auto data_chunk = (duckdb::DataChunk *)chunk;
 	return duckdb_appender_run_function(appender, [&](Appender &appender) { appender.AppendDataChunk(*data_chunk); });
 }
+
+duckdb_state duckdb_append_arrow_array(duckdb_appender appender, duckdb_arrow_schema arrow_schema,
+                                       duckdb_arrow_array arrow_array) {
+	if (!arrow_schema || !arrow_array) {
+		return DuckDBError;
+	}
+	auto schema = reinterpret_cast<ArrowSchema *>(arrow_schema);
+	auto array = reinterpret_cast<ArrowArray *>(arrow_array);
+	return duckdb_appender_run_function(appender, [&](Appender &appender) {
+		if (!schema->release || !array->release) {
+			throw duckdb::InvalidInputException("duckdb_append_arrow_array: released schema or array passed");
+		}
+		// the schema and array remain owned by the caller: wrap them without taking over the release callbacks
+		duckdb::ArrowSchemaWrapper schema_wrapper;
+		schema_wrapper.arrow_schema = *schema;
+		schema_wrapper.arrow_schema.release = nullptr;
+		auto array_wrapper = duckdb::make_uniq<duckdb::ArrowArrayWrapper>();
+		array_wrapper->arrow_array = *array;
+		array_wrapper->arrow_array.release = nullptr;
+
+		duckdb::ArrowTableType arrow_table;
+		duckdb::vector<duckdb::string> names;
+		duckdb::vector<LogicalType> arrow_types;
+		duckdb::ArrowTableFunction::PopulateArrowTableType(arrow_table, schema_wrapper, names, arrow_types);
+		auto &types = appender.GetTypes();
+		if (arrow_types.size() != types.size()) {
+			throw duckdb::InvalidInputException(
+			    "duckdb_append_arrow_array: the array has %llu columns, but the appender expects %llu columns",
+			    arrow_types.size(), types.size());
+		}
+		if (array->n_children != (int64_t)arrow_types.size()) {
+			throw duckdb::InvalidInputException("duckdb_append_arrow_array: array does not match the schema");
+		}
+
+		// convert the array one vector at a time, using the same conversion as the arrow scan
+		duckdb::ArrowScanLocalState scan_state(std::move(array_wrapper));
+		for (idx_t col_idx = 0; col_idx < arrow_types.size(); col_idx++) {
+			scan_state.column_ids.push_back(col_idx);
+		}
+		bool needs_cast = arrow_types != types;
+		DataChunk arrow_chunk;
+		arrow_chunk.Initialize(duckdb::Allocator::DefaultAllocator(), arrow_types);
+		DataChunk cast_chunk;
+		if (needs_cast) {
+			cast_chunk.Initialize(duckdb::Allocator::DefaultAllocator(), types);
+		}
+		auto length = idx_t(array->length);
+		while (scan_state.chunk_offset < length) {
+			auto count = duckdb::MinValue<idx_t>(STANDARD_VECTOR_SIZE, length - scan_state.chunk_offset);
+			arrow_chunk.Reset();
+			arrow_chunk.SetCardinality(count);
+			duckdb::ArrowTableFunction::ArrowToDuckDB(scan_state, arrow_table.GetColumns(), arrow_chunk,
+			                                          scan_state.chunk_offset);
+			if (needs_cast) {
+				cast_chunk.Reset();
+				cast_chunk.SetCardinality(count);
+				for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+					duckdb::VectorOperations::DefaultCast(arrow_chunk.data[col_idx], cast_chunk.data[col_idx], count,
+					                                      true);
+				}
+				appender.AppendDataChunk(cast_chunk);
+			} else {
+				appender.AppendDataChunk(arrow_chunk);
+			}
+			scan_state.chunk_offset += count;
+		}
+	});
+}
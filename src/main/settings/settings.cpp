@@ -987,6 +987,22 @@ Value ExportLargeBufferArrow::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(export_large_buffers_arrow);
 }
 
+//===--------------------------------------------------------------------===//
+// ProduceArrowStringView
+//===--------------------------------------------------------------------===//
+void ProduceArrowStringView::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.produce_arrow_string_view = input.GetValue<bool>();
+}
+
+void ProduceArrowStringView::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.produce_arrow_string_view = DBConfig().options.produce_arrow_string_view;
+}
+
+Value ProduceArrowStringView::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.produce_arrow_string_view);
+}
+
 //===--------------------------------------------------------------------===//
 // Profiler History Size
 //===--------------------------------------------------------------------===//
@@ -368,6 +368,16 @@ unique_ptr<LogicalOperator> QueryGraphManager::LeftRightOptimizations(unique_ptr
 							cond.comparison = FlipComparisonExpression(cond.comparison);
 						}
 					}
+				} else if (join.join_type == JoinType::OUTER && join.left_projection_map.empty() &&
+				           join.right_projection_map.empty()) {
+					// a full outer join is symmetric: build the hash table on the smaller side
+					if (LeftCardLessThanRight(*op)) {
+						std::swap(join.children[0], join.children[1]);
+						for (auto &cond : join.conditions) {
+							std::swap(cond.left, cond.right);
+							cond.comparison = FlipComparisonExpression(cond.comparison);
+						}
+					}
 				}
 				break;
 			}
@@ -139,9 +139,9 @@ void StatisticsPropagator::PropagateStatistics(LogicalComparisonJoin &join, uniq
 			}
 
 			// Update join_stats when is already part of the join
-			if (join.join_stats.size() == 2) {
-				join.join_stats[0] = std::move(updated_stats_left);
-				join.join_stats[1] = std::move(updated_stats_right);
+			if (join.join_stats.size() == 2 * (i + 1)) {
+				join.join_stats[2 * i] = std::move(updated_stats_left);
+				join.join_stats[2 * i + 1] = std::move(updated_stats_right);
 			}
 			break;
 		}
@@ -1289,6 +1289,15 @@ void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> d
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
 }
 
+unique_ptr<HyperLogLog> DataTable::GetDistinctSketch(DuckTransaction &transaction, column_t column_id) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	if (LocalStorage::Get(transaction).Find(*this)) {
+		// the transaction-local data is not part of the sketch
+		return nullptr;
+	}
+	return row_groups->GetDistinctSketch(TransactionData(transaction), column_id);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
@@ -47,6 +47,14 @@ void DistinctStatistics::Update(UnifiedVectorFormat &vdata, const LogicalType &t
 	log->AddToLog(vdata, count, indices, counts);
 }
 
+void DistinctStatistics::UpdateOverwritten(idx_t count) {
+	total_count += count;
+}
+
+bool DistinctStatistics::IsExact() const {
+	return sample_count == total_count;
+}
+
 string DistinctStatistics::ToString() const {
 	return StringUtil::Format("[Approx Unique: %s]", to_string(GetCount()));
 }
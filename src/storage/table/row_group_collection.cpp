@@ -520,6 +520,10 @@ void RowGroupCollection::Update(TransactionData transaction, row_t *ids, const v
 		for (idx_t i = 0; i < column_ids.size(); i++) {
 			auto column_id = column_ids[i];
 			stats.MergeStats(*l, column_id.index, *row_group->GetStatistics(column_id.index));
+			auto &column_stats = stats.GetStats(column_id.index);
+			if (column_stats.HasDistinctStats()) {
+				column_stats.DistinctStats().UpdateOverwritten(pos - start);
+			}
 		}
 	} while (pos < updates.size());
 }
@@ -786,4 +790,41 @@ void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStat
 	stats.GetStats(column_id).SetDistinct(std::move(distinct_stats));
 }
 
+unique_ptr<HyperLogLog> RowGroupCollection::GetDistinctSketch(TransactionData transaction, column_t column_id) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	unique_ptr<HyperLogLog> sketch;
+	idx_t sketch_count;
+	{
+		auto stats_guard = stats.GetLock();
+		auto &column_stats = stats.GetStats(column_id);
+		if (!column_stats.HasDistinctStats()) {
+			return nullptr;
+		}
+		auto &distinct_stats = column_stats.DistinctStats();
+		if (!distinct_stats.IsExact()) {
+			return nullptr;
+		}
+		sketch = distinct_stats.log->Copy();
+		sketch_count = distinct_stats.total_count;
+	}
+	// every value that was inserted is in the sketch, and rows that are deleted or reverted are never removed from
+	// it: the sketch describes the table if the transaction sees every row of the table, and nothing else
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t row_count = 0;
+	for (auto &row_group : row_groups->Segments()) {
+		idx_t vector_count = (row_group.count + STANDARD_VECTOR_SIZE - 1) / STANDARD_VECTOR_SIZE;
+		for (idx_t vector_idx = 0; vector_idx < vector_count; vector_idx++) {
+			auto max_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, row_group.count - vector_idx * STANDARD_VECTOR_SIZE);
+			if (row_group.GetSelVector(transaction, vector_idx, sel, max_count) != max_count) {
+				return nullptr;
+			}
+		}
+		row_count += row_group.count;
+	}
+	if (row_count != sketch_count) {
+		return nullptr;
+	}
+	return sketch;
+}
+
 } // namespace duckdb
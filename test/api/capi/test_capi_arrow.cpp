@@ -244,6 +244,70 @@ TEST_CASE("Test arrow in C API", "[capi][arrow]") {
 		duckdb_destroy_prepare(&stmt);
 	}
 
+	SECTION("test append arrow array") {
+		REQUIRE_NO_FAIL(tester.Query("CREATE TABLE target(i BIGINT, s VARCHAR, l INTEGER[])"));
+		REQUIRE(duckdb_query_arrow(tester.connection,
+		                           "SELECT i::INTEGER AS i, CASE WHEN i % 10 = 0 THEN NULL ELSE i::VARCHAR END AS s, "
+		                           "[i, i + 1]::INTEGER[] AS l FROM range(5000) t(i)",
+		                           &arrow_result) == DuckDBSuccess);
+
+		ArrowSchema *arrow_schema = new ArrowSchema();
+		REQUIRE(duckdb_query_arrow_schema(arrow_result, (duckdb_arrow_schema *)&arrow_schema) == DuckDBSuccess);
+
+		duckdb_appender appender;
+		REQUIRE(duckdb_appender_create(tester.connection, nullptr, "target", &appender) == DuckDBSuccess);
+		idx_t total_count = 0;
+		while (true) {
+			ArrowArray *arrow_array = new ArrowArray();
+			REQUIRE(duckdb_query_arrow_array(arrow_result, (duckdb_arrow_array *)&arrow_array) == DuckDBSuccess);
+			if (arrow_array->length == 0) {
+				delete arrow_array;
+				break;
+			}
+			total_count += arrow_array->length;
+			REQUIRE(duckdb_append_arrow_array(appender, (duckdb_arrow_schema)arrow_schema,
+			                                  (duckdb_arrow_array)arrow_array) == DuckDBSuccess);
+			// the array is still owned by us
+			REQUIRE(arrow_array->release != nullptr);
+			arrow_array->release(arrow_array);
+			delete arrow_array;
+		}
+		REQUIRE(total_count == 5000);
+		REQUIRE(duckdb_appender_destroy(&appender) == DuckDBSuccess);
+
+		result = tester.Query("SELECT COUNT(*), SUM(i), COUNT(s), SUM(s::BIGINT), SUM(l[2]) FROM target");
+		REQUIRE_NO_FAIL(*result);
+		REQUIRE(result->Fetch<int64_t>(0, 0) == 5000);
+		REQUIRE(result->Fetch<int64_t>(1, 0) == 12497500);
+		REQUIRE(result->Fetch<int64_t>(2, 0) == 4500);
+		REQUIRE(result->Fetch<int64_t>(3, 0) == 11250000);
+		REQUIRE(result->Fetch<int64_t>(4, 0) == 12502500);
+
+		// a schema with the wrong number of columns is rejected
+		REQUIRE(duckdb_appender_create(tester.connection, nullptr, "target", &appender) == DuckDBSuccess);
+		duckdb_arrow wrong_result;
+		REQUIRE(duckdb_query_arrow(tester.connection, "SELECT 42 AS i", &wrong_result) == DuckDBSuccess);
+		ArrowSchema *wrong_schema = new ArrowSchema();
+		REQUIRE(duckdb_query_arrow_schema(wrong_result, (duckdb_arrow_schema *)&wrong_schema) == DuckDBSuccess);
+		ArrowArray *wrong_array = new ArrowArray();
+		REQUIRE(duckdb_query_arrow_array(wrong_result, (duckdb_arrow_array *)&wrong_array) == DuckDBSuccess);
+		REQUIRE(duckdb_append_arrow_array(appender, (duckdb_arrow_schema)wrong_schema,
+		                                  (duckdb_arrow_array)wrong_array) == DuckDBError);
+		REQUIRE(duckdb_appender_error(appender) != nullptr);
+		REQUIRE(duckdb_append_arrow_array(appender, nullptr, nullptr) == DuckDBError);
+		REQUIRE(duckdb_appender_destroy(&appender) == DuckDBSuccess);
+
+		wrong_array->release(wrong_array);
+		delete wrong_array;
+		wrong_schema->release(wrong_schema);
+		delete wrong_schema;
+		duckdb_destroy_arrow(&wrong_result);
+
+		arrow_schema->release(arrow_schema);
+		delete arrow_schema;
+		duckdb_destroy_arrow(&arrow_result);
+	}
+
 	// FIXME: needs test for scanning a fixed size list
 	// this likely requires nanoarrow to create the array to scan
 }
@@ -1,6 +1,8 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
 
+#include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/storage/object_cache.hpp"
 
 using namespace duckdb;
@@ -56,3 +58,90 @@ TEST_CASE("Test ObjectCache", "[api]") {
 
 	REQUIRE(cache.GetOrCreate<AnotherTestObject>("test", 13) == nullptr);
 }
+
+//! Reads local files with the "sniffer_cache://" prefix, counts the reads and reports the same modification time
+class SnifferCacheFileSystem : public LocalFileSystem {
+public:
+	static constexpr const char *PREFIX = "sniffer_cache://";
+
+	duckdb::unique_ptr<FileHandle> OpenFile(const string &path, uint8_t flags, FileLockType lock,
+	                                        FileCompressionType compression, FileOpener *opener) override {
+		return LocalFileSystem::OpenFile(path.substr(strlen(PREFIX)), flags, lock, compression, opener);
+	}
+	duckdb::vector<string> Glob(const string &path, FileOpener *opener) override {
+		return {path};
+	}
+	bool CanHandleFile(const string &path) override {
+		return StringUtil::StartsWith(path, PREFIX);
+	}
+	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override {
+		read_count++;
+		LocalFileSystem::Read(handle, buffer, nr_bytes, location);
+	}
+	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
+		read_count++;
+		return LocalFileSystem::Read(handle, buffer, nr_bytes);
+	}
+	time_t GetLastModifiedTime(FileHandle &handle) override {
+		return last_modified;
+	}
+	string GetName() const override {
+		return "SnifferCacheFileSystem";
+	}
+
+	atomic<idx_t> read_count {0};
+	time_t last_modified = 0;
+};
+
+TEST_CASE("Test CSV sniffer cache", "[api]") {
+	DBConfig config;
+	config.options.object_cache_enable = true;
+	DuckDB db(nullptr, &config);
+	Connection con(db);
+	auto file_system = make_uniq<SnifferCacheFileSystem>();
+	auto &fs = *file_system;
+	db.instance->GetFileSystem().RegisterSubSystem(std::move(file_system));
+
+	// binding a scan only reads from the file if the file is sniffed
+	auto is_sniffed = [&](const string &query) {
+		fs.read_count = 0;
+		REQUIRE(!con.Prepare(query)->HasError());
+		return fs.read_count > 0;
+	};
+	auto csv_path = TestCreatePath("sniffer_cache.csv");
+	auto query = "SELECT * FROM read_csv_auto('" + string(SnifferCacheFileSystem::PREFIX) + csv_path + "')";
+	REQUIRE_NO_FAIL(con.Query("COPY (SELECT 42 AS a, 'hello' AS b) TO '" + csv_path + "' (HEADER)"));
+
+	// files that were modified just before they were sniffed are sniffed again
+	fs.last_modified = time(nullptr);
+	REQUIRE(is_sniffed(query));
+	REQUIRE(is_sniffed(query));
+
+	// the sniffer result of older files is reused
+	fs.last_modified = time(nullptr) - 3600;
+	REQUIRE(is_sniffed(query));
+	REQUIRE(!is_sniffed(query));
+	auto result = con.Query(query);
+	REQUIRE(CHECK_COLUMN(result, 0, {42}));
+	REQUIRE(CHECK_COLUMN(result, 1, {"hello"}));
+
+	// options that are not serialized are part of the key
+	auto single_threaded_query =
+	    "SELECT * FROM read_csv_auto('" + string(SnifferCacheFileSystem::PREFIX) + csv_path + "', parallel=false)";
+	REQUIRE(is_sniffed(single_threaded_query));
+	REQUIRE(!is_sniffed(single_threaded_query));
+	REQUIRE(!is_sniffed(query));
+
+	// a new modification time invalidates the sniffer result
+	fs.last_modified -= 60;
+	REQUIRE(is_sniffed(query));
+	REQUIRE(!is_sniffed(query));
+
+	// and so does a new file size
+	REQUIRE_NO_FAIL(con.Query("COPY (SELECT 'world' AS x, 84 AS y, 1.5 AS z) TO '" + csv_path + "' (HEADER)"));
+	REQUIRE(is_sniffed(query));
+	result = con.Query(query);
+	REQUIRE(CHECK_COLUMN(result, 0, {"world"}));
+	REQUIRE(CHECK_COLUMN(result, 1, {84}));
+	REQUIRE(CHECK_COLUMN(result, 2, {1.5}));
+}
@@ -309,3 +309,26 @@ TEST_CASE("Test alter table in the middle of append", "[appender]") {
 		REQUIRE_THROWS(appender.Close());
 	}
 }
+
+TEST_CASE("Test appender flushes complete row groups", "[appender]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers(i INTEGER)"));
+	idx_t row_count = Storage::ROW_GROUP_SIZE * 4;
+	{
+		Appender appender(con, "integers");
+		for (idx_t i = 0; i < row_count; i++) {
+			appender.AppendRow(int32_t(i));
+		}
+		appender.Close();
+	}
+	result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(row_count)}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(row_count * (row_count - 1) / 2)}));
+
+	// every intermediate flush should have produced full row groups
+	result = con.Query("SELECT COUNT(DISTINCT row_group_id) FROM pragma_storage_info('integers')");
+	REQUIRE(CHECK_COLUMN(result, 0, {4}));
+}
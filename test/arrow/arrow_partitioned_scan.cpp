@@ -0,0 +1,218 @@
+#include "catch.hpp"
+
+#include "arrow/arrow_test_helper.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+using namespace duckdb;
+
+namespace {
+
+//! In-process producer with a fixed amount of partitions of the table (i BIGINT, s VARCHAR), where i = 0..N-1 and
+//! s = 'str' || i. The producer applies the pushed down projection and filters itself.
+struct MockPartitionedProducer {
+	MockPartitionedProducer(idx_t partition_count, idx_t rows_per_partition, idx_t rows_per_array)
+	    : partition_count(partition_count), rows_per_partition(rows_per_partition), rows_per_array(rows_per_array),
+	      options(ClientProperties("UTC", ArrowOffsetSize::REGULAR)) {
+	}
+
+	idx_t partition_count;
+	idx_t rows_per_partition;
+	idx_t rows_per_array;
+	ClientProperties options;
+	atomic<idx_t> produced_partitions {0};
+	//! The projected columns of the last produced partition
+	mutex lock;
+	vector<string> last_projection;
+
+	vector<Value> GetParameters() {
+		vector<Value> params;
+		params.push_back(Value::POINTER((uintptr_t)this));
+		params.push_back(Value::POINTER((uintptr_t)&ProducePartition));
+		params.push_back(Value::POINTER((uintptr_t)&GetSchema));
+		params.push_back(Value::POINTER((uintptr_t)&GetPartitionCount));
+		return params;
+	}
+
+	static idx_t GetPartitionCount(uintptr_t factory_ptr) {
+		return reinterpret_cast<MockPartitionedProducer *>(factory_ptr)->partition_count;
+	}
+
+	static void GetSchema(uintptr_t factory_ptr, ArrowSchemaWrapper &schema) {
+		auto &producer = *reinterpret_cast<MockPartitionedProducer *>(factory_ptr);
+		ArrowConverter::ToArrowSchema(&schema.arrow_schema, {LogicalType::BIGINT, LogicalType::VARCHAR}, {"i", "s"},
+		                              producer.options);
+	}
+
+	static bool FilterMatches(const TableFilter &filter, int64_t value) {
+		switch (filter.filter_type) {
+		case TableFilterType::CONSTANT_COMPARISON: {
+			auto &constant_filter = filter.Cast<ConstantFilter>();
+			auto constant = constant_filter.constant.GetValue<int64_t>();
+			switch (constant_filter.comparison_type) {
+			case ExpressionType::COMPARE_EQUAL:
+				return value == constant;
+			case ExpressionType::COMPARE_GREATERTHAN:
+				return value > constant;
+			case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+				return value >= constant;
+			case ExpressionType::COMPARE_LESSTHAN:
+				return value < constant;
+			case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+				return value <= constant;
+			default:
+				throw NotImplementedException("Unsupported comparison in mock producer");
+			}
+		}
+		case TableFilterType::CONJUNCTION_AND: {
+			for (auto &child : filter.Cast<ConjunctionAndFilter>().child_filters) {
+				if (!FilterMatches(*child, value)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		case TableFilterType::IS_NOT_NULL:
+			return true;
+		default:
+			throw NotImplementedException("Unsupported filter in mock producer");
+		}
+	}
+
+	static unique_ptr<ArrowArrayStreamWrapper> ProducePartition(uintptr_t factory_ptr,
+	                                                            ArrowStreamParameters &parameters,
+	                                                            idx_t partition_idx) {
+		auto &producer = *reinterpret_cast<MockPartitionedProducer *>(factory_ptr);
+		producer.produced_partitions++;
+		auto &columns = parameters.projected_columns.columns;
+		{
+			lock_guard<mutex> guard(producer.lock);
+			producer.last_projection = columns;
+		}
+		vector<LogicalType> types;
+		for (auto &column : columns) {
+			types.push_back(column == "i" ? LogicalType::BIGINT : LogicalType::VARCHAR);
+		}
+		vector<const TableFilter *> filters;
+		if (parameters.filters) {
+			for (auto &entry : parameters.filters->filters) {
+				if (parameters.projected_columns.projection_map[entry.first] != "i") {
+					throw NotImplementedException("Unsupported filter column in mock producer");
+				}
+				filters.push_back(entry.second.get());
+			}
+		}
+
+		auto stream = new MockStream();
+		DataChunk chunk;
+		chunk.Initialize(Allocator::DefaultAllocator(), types);
+		auto flush = [&]() {
+			ArrowAppender appender(types, chunk.size(), producer.options);
+			appender.Append(chunk, 0, chunk.size(), chunk.size());
+			stream->arrays.push_back(appender.Finalize());
+			chunk.Reset();
+		};
+		auto start = partition_idx * producer.rows_per_partition;
+		for (idx_t row = start; row < start + producer.rows_per_partition; row++) {
+			auto value = int64_t(row);
+			bool matches = true;
+			for (auto &filter : filters) {
+				matches = matches && FilterMatches(*filter, value);
+			}
+			if (!matches) {
+				continue;
+			}
+			for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+				chunk.SetValue(col_idx, chunk.size(),
+				               columns[col_idx] == "i" ? Value::BIGINT(value) : Value("str" + to_string(value)));
+			}
+			chunk.SetCardinality(chunk.size() + 1);
+			if (chunk.size() == MinValue<idx_t>(producer.rows_per_array, STANDARD_VECTOR_SIZE)) {
+				flush();
+			}
+		}
+		if (chunk.size() > 0) {
+			flush();
+		}
+
+		auto result = make_uniq<ArrowArrayStreamWrapper>();
+		result->number_of_rows = -1;
+		result->arrow_array_stream.private_data = stream;
+		result->arrow_array_stream.get_schema = MockStream::GetSchema;
+		result->arrow_array_stream.get_next = MockStream::GetNext;
+		result->arrow_array_stream.get_last_error = MockStream::GetLastError;
+		result->arrow_array_stream.release = MockStream::Release;
+		return result;
+	}
+
+	struct MockStream {
+		vector<ArrowArray> arrays;
+		idx_t next = 0;
+
+		static int GetSchema(struct ArrowArrayStream *stream, struct ArrowSchema *out) {
+			return -1;
+		}
+		static int GetNext(struct ArrowArrayStream *stream, struct ArrowArray *out) {
+			auto &mock = *reinterpret_cast<MockStream *>(stream->private_data);
+			if (mock.next >= mock.arrays.size()) {
+				out->release = nullptr;
+				return 0;
+			}
+			*out = mock.arrays[mock.next++];
+			return 0;
+		}
+		static const char *GetLastError(struct ArrowArrayStream *stream) {
+			return "";
+		}
+		static void Release(struct ArrowArrayStream *stream) {
+			auto mock = reinterpret_cast<MockStream *>(stream->private_data);
+			for (; mock->next < mock->arrays.size(); mock->next++) {
+				auto &array = mock->arrays[mock->next];
+				array.release(&array);
+			}
+			delete mock;
+			stream->release = nullptr;
+		}
+	};
+};
+
+} // namespace
+
+TEST_CASE("Test arrow scan of a partitioned producer", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("SET threads=4"));
+
+	MockPartitionedProducer producer(16, 10000, 1000);
+	con.TableFunction("arrow_scan_partitioned", producer.GetParameters())->CreateView("partitioned", true, true);
+
+	auto result = con.Query("SELECT COUNT(*), SUM(i), COUNT(DISTINCT s) FROM partitioned");
+	REQUIRE(CHECK_COLUMN(result, 0, {160000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::HUGEINT(12799920000)}));
+	REQUIRE(CHECK_COLUMN(result, 2, {160000}));
+	REQUIRE(producer.produced_partitions == 16);
+
+	// only the projected columns are produced
+	result = con.Query("SELECT MAX(s) FROM partitioned");
+	REQUIRE(CHECK_COLUMN(result, 0, {"str99999"}));
+	REQUIRE(producer.last_projection == vector<string> {"s"});
+
+	// the filters are applied by the producer
+	result = con.Query("SELECT COUNT(*), MIN(i), MAX(s) FROM partitioned WHERE i >= 15000 AND i < 25010");
+	REQUIRE(CHECK_COLUMN(result, 0, {10010}));
+	REQUIRE(CHECK_COLUMN(result, 1, {15000}));
+	REQUIRE(CHECK_COLUMN(result, 2, {"str25009"}));
+
+	// the order of the partitions is preserved
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE ordered AS SELECT * FROM partitioned"));
+	result = con.Query("SELECT COUNT(*) FROM ordered WHERE rowid <> i OR s <> 'str' || i");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+	result = con.Query("SELECT i FROM partitioned LIMIT 3 OFFSET 54321");
+	REQUIRE(CHECK_COLUMN(result, 0, {54321, 54322, 54323}));
+
+	// a producer without partitions is empty
+	MockPartitionedProducer empty_producer(0, 10000, 1000);
+	con.TableFunction("arrow_scan_partitioned", empty_producer.GetParameters())->CreateView("empty", true, true);
+	result = con.Query("SELECT COUNT(*) FROM empty");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+}
@@ -1,16 +1,26 @@
 #include "catch.hpp"
 
 #include "arrow/arrow_test_helper.hpp"
+#include "duckdb/common/arrow/arrow_appender.hpp"
+#include "duckdb/common/arrow/arrow_converter.hpp"
+#include "duckdb/common/arrow/result_arrow_wrapper.hpp"
+#include "duckdb/execution/operator/helper/physical_arrow_collector.hpp"
+#include "duckdb/main/arrow_query_result.hpp"
 
 using namespace duckdb;
 
-static void TestArrowRoundtrip(const string &query, bool export_large_buffer = false) {
+static void TestArrowRoundtrip(const string &query, bool export_large_buffer = false,
+                               bool produce_string_view = false) {
 	DuckDB db;
 	Connection con(db);
 	if (export_large_buffer) {
 		auto res = con.Query("SET arrow_large_buffer_size=True");
 		REQUIRE(!res->HasError());
 	}
+	if (produce_string_view) {
+		auto res = con.Query("SET produce_arrow_string_view=True");
+		REQUIRE(!res->HasError());
+	}
 	REQUIRE(ArrowTestHelper::RunArrowComparison(con, query, true));
 	REQUIRE(ArrowTestHelper::RunArrowComparison(con, query, false));
 }
@@ -46,6 +56,104 @@ TEST_CASE("Test Export Large", "[arrow]") {
 	TestArrowRoundtrip("SELECT '3d038406-6275-4aae-bec1-1235ccdeaade'::UUID FROM range(10000) tbl(i)", true);
 }
 
+TEST_CASE("Test Export String View", "[arrow]") {
+	TestArrowRoundtrip("SELECT 'bla' FROM range(10000)", false, true);
+	TestArrowRoundtrip("SELECT 'thisisalongstring' || i FROM range(10000) tbl(i)", false, true);
+	TestArrowRoundtrip("SELECT CASE WHEN i % 3 = 0 THEN NULL WHEN i % 3 = 1 THEN 'short' || i ELSE "
+	                   "repeat('long', i % 20) END FROM range(10000) tbl(i)",
+	                   false, true);
+	TestArrowRoundtrip("SELECT ('bla' || i)::BLOB, repeat('blob', 5)::BLOB FROM range(10000) tbl(i)", false, true);
+	TestArrowRoundtrip("SELECT [i::VARCHAR, NULL, 'thisisalongstring' || i] l, {'s': 'thisisalongstring' || i} s "
+	                   "FROM range(1000) tbl(i)",
+	                   false, true);
+	TestArrowRoundtrip("SELECT list_extract(['a', 'thisisalongstring'], 1 + i % 2)::ENUM('a', 'thisisalongstring') "
+	                   "FROM range(100) tbl(i)",
+	                   false, true);
+}
+
+static unique_ptr<QueryResult> CollectArrow(Connection &con, const string &query, idx_t batch_size) {
+	con.context->config.result_collector = [batch_size](ClientContext &context, PreparedStatementData &data) {
+		return PhysicalArrowCollector::Create(context, data, batch_size);
+	};
+	auto result = con.context->Query(query, false);
+	con.context->config.result_collector = nullptr;
+	REQUIRE(!result->HasError());
+	REQUIRE(result->type == QueryResultType::ARROW_RESULT);
+	return result;
+}
+
+TEST_CASE("Test Arrow collector", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("SET threads=4"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE tbl AS SELECT i, 'str' || i AS s FROM range(500000) t(i)"));
+
+	for (idx_t batch_size : {idx_t(100), idx_t(STANDARD_VECTOR_SIZE), idx_t(1000000)}) {
+		// the arrays are converted in parallel, but they are returned in insertion order
+		auto result = CollectArrow(con, "SELECT i, s FROM tbl", batch_size);
+		auto &arrow_result = result->Cast<ArrowQueryResult>();
+		REQUIRE(arrow_result.RowCount() == 500000);
+		int64_t expected = 0;
+		for (auto &array : arrow_result.Arrays()) {
+			REQUIRE(idx_t(array->arrow_array.length) <= batch_size);
+			auto values = reinterpret_cast<const int64_t *>(array->arrow_array.children[0]->buffers[1]);
+			for (int64_t row = 0; row < array->arrow_array.length; row++) {
+				REQUIRE(values[row] == expected++);
+			}
+		}
+
+		// the arrays can be consumed as a record batch reader
+		auto wrapper = new ResultArrowArrayStreamWrapper(CollectArrow(con, "SELECT i, s FROM tbl", batch_size),
+		                                                 batch_size);
+		REQUIRE(ArrowTestHelper::RunArrowComparison(con, "SELECT i, s FROM tbl", wrapper->stream));
+	}
+
+	// single-threaded collection of an order preserving plan without batch indexes
+	auto wrapper = new ResultArrowArrayStreamWrapper(
+	    CollectArrow(con, "SELECT i, s FROM tbl ORDER BY i DESC LIMIT 100000 OFFSET 10", 1000), 1000);
+	REQUIRE(ArrowTestHelper::RunArrowComparison(con, "SELECT i, s FROM tbl ORDER BY i DESC LIMIT 100000 OFFSET 10",
+	                                            wrapper->stream));
+
+	// without insertion order the arrays are collected in any order
+	REQUIRE_NO_FAIL(con.Query("SET preserve_insertion_order=false"));
+	auto result = CollectArrow(con, "SELECT i, s FROM tbl WHERE i % 3 = 0", 1000);
+	REQUIRE(result->Cast<ArrowQueryResult>().RowCount() == 166667);
+
+	// empty results have no arrays
+	result = CollectArrow(con, "SELECT i, s FROM tbl WHERE i < 0", 1000);
+	REQUIRE(result->Cast<ArrowQueryResult>().Arrays().empty());
+}
+
+TEST_CASE("Test Export ENUM dictionary with String Views", "[arrow]") {
+	DuckDB db;
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("SET produce_arrow_string_view=True"));
+	auto query = "SELECT list_extract(['a', 'thisisalongstring'], 1 + i % 2)::ENUM('a', 'thisisalongstring') e "
+	             "FROM range(100) tbl(i)";
+
+	// the dictionary is declared as a regular string array
+	auto materialized = con.Query(query);
+	REQUIRE(!materialized->HasError());
+	ArrowSchemaWrapper schema;
+	ArrowConverter::ToArrowSchema(&schema.arrow_schema, materialized->types, materialized->names,
+	                              con.context->GetClientProperties());
+	REQUIRE(string(schema.arrow_schema.children[0]->dictionary->format) == "u");
+
+	// and laid out as one: validity, offsets and data
+	auto chunk = materialized->Fetch();
+	ArrowAppender appender(materialized->types, chunk->size(), con.context->GetClientProperties());
+	appender.Append(*chunk, 0, chunk->size(), chunk->size());
+	ArrowArrayWrapper array;
+	array.arrow_array = appender.Finalize();
+	auto dictionary = array.arrow_array.children[0]->dictionary;
+	REQUIRE(dictionary->length == 2);
+	REQUIRE(dictionary->n_buffers == 3);
+	auto offsets = reinterpret_cast<const uint32_t *>(dictionary->buffers[1]);
+	auto data = reinterpret_cast<const char *>(dictionary->buffers[2]);
+	REQUIRE(string(data + offsets[0], offsets[1] - offsets[0]) == "a");
+	REQUIRE(string(data + offsets[1], offsets[2] - offsets[1]) == "thisisalongstring");
+}
+
 TEST_CASE("Test arrow roundtrip", "[arrow]") {
 	TestArrowRoundtrip("SELECT * FROM range(10000) tbl(i) UNION ALL SELECT NULL");
 	TestArrowRoundtrip("SELECT m from (select MAP(list_value(1), list_value(2)) from range(5) tbl(i)) tbl(m)");